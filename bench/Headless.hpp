@@ -0,0 +1,192 @@
+#ifndef GTX__BENCH_HEADLESS_HPP
+#define GTX__BENCH_HEADLESS_HPP
+
+
+//============================================================================================================
+//! \brief Running Gratrix modules without Rack, for the tools in bench/ built on "make dsp".
+
+#include "Gratrix.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+void init(rack::Plugin *p);  // src/Gratrix.cpp
+
+
+namespace GTX {
+namespace Headless {
+
+
+//============================================================================================================
+//! \brief The plugin as Rack would load it, models found by slug.
+
+inline rack::Plugin &load()
+{
+	if (!::plugin)
+	{
+		init(new rack::Plugin());
+	}
+
+	return *::plugin;
+}
+
+inline rack::Model *model(const std::string &slug)
+{
+	rack::Model *m = load().getModel(slug);
+
+	if (!m)
+	{
+		std::fprintf(stderr, "unknown module \"%s\"\n", slug.c_str());
+		std::exit(1);
+	}
+
+	return m;
+}
+
+
+//============================================================================================================
+//! \brief Fixed scripted input, every input patched.
+//!
+//! A table of FRAMES frames played in a loop, so making the input costs a copy.  Every third input is a
+//! gate, the rest are sines, each at a different whole number of cycles per loop so nothing lines up.
+//! At 44.1 kHz the loop is 0.19 s, the sines run from 5 to 35 Hz and the gates from 10 to 50 Hz.
+
+struct Stimulus
+{
+	static constexpr std::size_t FRAMES = 8192;
+
+	std::size_t inputs;
+	std::vector<float> table;  // FRAMES rows of 'inputs' values
+	std::size_t frame = 0;
+
+	explicit Stimulus(std::size_t inputs, float amplitude = 5.0f)
+	:
+		inputs(inputs),
+		table(FRAMES * inputs)
+	{
+		for (std::size_t i=0; i<inputs; ++i)
+		{
+			bool   gate   = (i % 3 == 2);
+			double cycles = gate ? 2 * (i % 5 + 1) : i % 7 + 1;
+
+			for (std::size_t f=0; f<FRAMES; ++f)
+			{
+				double phase = cycles * f / FRAMES;
+				table[f * inputs + i] = gate
+					? (phase - std::floor(phase) < 0.5 ? 10.0f : 0.0f)
+					: amplitude * static_cast<float>(std::sin(GTX__2PI * phase));
+			}
+		}
+	}
+
+	//! \brief Connects every port of 'module'.
+	void patch(rack::Module &module)
+	{
+		for (rack::Input  &in  : module.inputs ) in.active  = true;
+		for (rack::Output &out : module.outputs) out.active = true;
+	}
+
+	//! \brief Writes the next frame to the inputs of 'module'.
+	void apply(rack::Module &module)
+	{
+		const float *row = &table[frame * inputs];
+
+		for (std::size_t i=0; i<inputs; ++i) module.inputs[i].value = row[i];
+
+		if (++frame == FRAMES) frame = 0;
+	}
+};
+
+
+//============================================================================================================
+//! \brief A module driven by a Stimulus.
+
+struct Rig
+{
+	std::unique_ptr<rack::Module> module;
+	Stimulus stimulus;
+
+	static rack::Module *create(const std::string &slug, float rate)
+	{
+		rack::engineSetSampleRate(rate);
+		return model(slug)->createModule();
+	}
+
+	//! \brief Loads the state of 'module' from 'json' as a patch would, nothing if empty.
+	static void load(rack::Module &module, const std::string &json)
+	{
+		if (json.empty()) return;
+
+		json_error_t error;
+
+		if (json_t *rootJ = json_loads(json.c_str(), 0, &error))
+		{
+			module.fromJson(rootJ);
+			json_decref(rootJ);
+		}
+		else
+		{
+			std::fprintf(stderr, "bad module json: %s\n", error.text);
+			std::exit(1);
+		}
+	}
+
+	//! \brief Makes the module at 'rate', with its state loaded from 'json' if not empty.
+	Rig(const std::string &slug, float rate, const std::string &json = "")
+	:
+		module(create(slug, rate)),
+		stimulus(module->inputs.size())
+	{
+		load(*module, json);
+		module->onSampleRateChange();
+		stimulus.patch(*module);
+	}
+
+	void run(std::size_t frames)
+	{
+		for (std::size_t f=0; f<frames; ++f)
+		{
+			stimulus.apply(*module);
+			module->step();
+		}
+	}
+};
+
+
+//============================================================================================================
+//! \brief Voices a model runs, as its module says through Voices<N>, one for modules without voices.
+
+inline std::size_t voices(const std::string &slug)
+{
+	std::unique_ptr<rack::Module> module(Rig::create(slug, rack::engineGetSampleRate()));
+
+	const VoiceCount *count = dynamic_cast<const VoiceCount *>(module.get());
+
+	return count ? count->voice_count : 1;
+}
+
+
+//============================================================================================================
+//! \brief Wall-clock nanoseconds spent in 'f'.
+
+template <typename TFunc> double nanoseconds(TFunc f)
+{
+	auto start = std::chrono::steady_clock::now();
+	f();
+	auto stop = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+
+} // Headless
+} // GTX
+
+
+#endif
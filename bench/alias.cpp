@@ -0,0 +1,371 @@
+//============================================================================================================
+//! \brief Aliasing and harmonic accuracy of the oscillators, per mode, against ideal band-limited output.
+//!
+//! Build and run with "make alias", or run build/alias directly:
+//!
+//!   build/alias [-r rate] [-n log2 size] [slug ...]
+//!
+//! For VCO-F1 and VCO-F2 (or the slugs given) in digital and analog mode, free running, hard synced and
+//! soft synced, every waveform is run at pitches from C2 to the top of the knob on one voice.  The output
+//! after a settling time is windowed (4-term Blackman-Harris, sidelobes at -92 dB) and transformed, and
+//! its power split into bands around each harmonic of the period below Nyquist, the signal, and all
+//! else, the aliases.  Reported per row are:
+//!
+//!   alias    total alias power over signal power, dB
+//!   worst    the largest single alias bin over the strongest harmonic, dBc
+//!   harm     difference of the harmonic magnitudes from the ideal shape's Fourier series, each set
+//!            scaled to unit power, dB, which takes in the decimator's roll-off towards Nyquist
+//!   ns       per sample for the module, a rough figure, use "make bench" for costs
+//!
+//! A synced oscillator repeats at the master's frequency, which is set a ratio of 2.37 below the pitch
+//! and on an FFT bin.  Soft sync reverses the phase rather than resetting it, the output repeats over
+//! two master cycles from a starting phase that depends on history, so it has no harm figure.  The ideal
+//! shapes for analog mode are its tables and quadratic sine, for its square the unfiltered pulse, so
+//! its harm includes the high-pass colour.  The window's floor bounds every figure near -90 dB.
+
+#include "Headless.hpp"
+
+#include <algorithm>
+#include <complex>
+#include <cstring>
+
+
+using namespace GTX::Headless;
+
+
+namespace GTX {
+extern float sawTable[2048];  // src/VCO.cpp
+extern float triTable[2048];
+}
+
+
+//============================================================================================================
+//! \brief In place radix-2 FFT, size a power of two.
+
+static void fft(std::vector<std::complex<double>> &x)
+{
+	std::size_t n = x.size();
+
+	for (std::size_t i=1, j=0; i<n; ++i)
+	{
+		std::size_t bit = n >> 1;
+		for (; j & bit; bit >>= 1) j ^= bit;
+		j ^= bit;
+		if (i < j) std::swap(x[i], x[j]);
+	}
+
+	for (std::size_t len=2; len<=n; len<<=1)
+	{
+		std::complex<double> w = std::polar(1.0, -GTX__2PI / len);
+
+		for (std::size_t i=0; i<n; i+=len)
+		{
+			std::complex<double> wk = 1.0;
+
+			for (std::size_t k=0; k<len/2; ++k, wk*=w)
+			{
+				std::complex<double> u = x[i + k];
+				std::complex<double> v = x[i + k + len/2] * wk;
+				x[i + k]         = u + v;
+				x[i + k + len/2] = u - v;
+			}
+		}
+	}
+}
+
+
+//============================================================================================================
+//! \brief The waveforms as VoltageControlledOscillator forms them before oversampling, 'phase' in [0, 1).
+
+enum Shape { SIN, TRI, SAW, SQR, SHAPES };
+
+static const char *shapeNames[SHAPES] = {"sin", "tri", "saw", "sqr"};
+
+static double ideal(Shape shape, bool analog, double phase)
+{
+	if (analog)
+	{
+		switch (shape)
+		{
+			case SIN : return phase < 0.5 ? 1.0 - 16.0 * (phase - 0.25) * (phase - 0.25) : -1.0 + 16.0 * (phase - 0.75) * (phase - 0.75);
+			case TRI : return rack::interpolateLinear(GTX::triTable, phase * 2047.f);
+			case SAW : return rack::interpolateLinear(GTX::sawTable, phase * 2047.f);
+			default  : break;
+		}
+	}
+	else
+	{
+		switch (shape)
+		{
+			case SIN : return std::sin(GTX__2PI * phase);
+			case TRI : return phase < 0.25 ? 4.0 * phase : phase < 0.75 ? 2.0 - 4.0 * phase : -4.0 + 4.0 * phase;
+			case SAW : return phase < 0.5 ? 2.0 * phase : -2.0 + 2.0 * phase;
+			default  : break;
+		}
+	}
+
+	return phase < 0.5 ? 1.0 : -1.0;
+}
+
+//! \brief Magnitudes of the first 'count' harmonics of the ideal output, 'ratio' cycles of the shape per
+//! period reset at the start of each (hard sync, or 1 for free running).
+static std::vector<double> series(Shape shape, bool analog, double ratio, std::size_t count)
+{
+	const std::size_t M = std::max<std::size_t>(16384, 16 * count);
+
+	std::vector<double> wave(M);
+	for (std::size_t m=0; m<M; ++m)
+	{
+		double phase = ratio * m / M;
+		wave[m] = ideal(shape, analog, phase - std::floor(phase));
+	}
+
+	std::vector<double> magnitude(count + 1);
+	for (std::size_t k=1; k<=count; ++k)
+	{
+		std::complex<double> sum = 0.0, w = std::polar(1.0, -GTX__2PI * k / M), wm = 1.0;
+		for (std::size_t m=0; m<M; ++m, wm*=w) sum += wave[m] * wm;
+		magnitude[k] = std::abs(sum);
+	}
+
+	return magnitude;
+}
+
+
+//============================================================================================================
+//! \brief One oscillator configuration, rendered and measured.
+
+enum Sync { FREE, HARD, SOFT, SYNCS };
+
+static const char *syncNames[SYNCS] = {"free", "hard sync", "soft sync"};
+
+struct Measure
+{
+	std::size_t size;  // FFT length
+	float rate;
+	std::vector<double> window;
+
+	static constexpr int    BAND  = 6;     // Bins either side of a harmonic counted as that harmonic
+	static constexpr double RATIO = 2.37;  // Pitch over sync master
+
+	Measure(std::size_t size, float rate) : size(size), rate(rate), window(size)
+	{
+		for (std::size_t i=0; i<size; ++i)
+		{
+			double x = GTX__2PI * i / size;
+			window[i] = 0.35875 - 0.48829 * std::cos(x) + 0.14128 * std::cos(2 * x) - 0.01168 * std::cos(3 * x);
+		}
+	}
+
+	struct Result
+	{
+		double alias, worst, harm, ns;
+	};
+
+	//! \brief Captures the output of voice 0 of 'slug'.
+	std::vector<double> render(const std::string &slug, Shape shape, bool analog, Sync sync, float semitones, double master, double &ns)
+	{
+		std::unique_ptr<rack::Module> module(Rig::create(slug, rate));
+
+		bool f1 = module->params.size() == 7;  // VCO-F1: MODE, SYNC, FREQ, FINE, FM, PW, PWM
+
+		module->params[0].value = analog ? 1.0f : 0.0f;
+		module->params[1].value = sync == SOFT ? 0.0f : 1.0f;
+		module->params[2].value = semitones;
+
+		if (f1) module->params[5].value = 0.5f;              // PW
+		else    module->params[3].value = float(shape);      // WAVE, the shapes at whole positions
+
+		rack::Output &out = module->outputs[f1 ? shape : 0];
+		out.active = true;
+
+		rack::Input *syncIn = nullptr;
+		if (sync != FREE)
+		{
+			syncIn = &module->inputs[f1 ? 2 : 1];               // SYNC
+			syncIn->active = true;
+		}
+
+		module->onSampleRateChange();
+
+		std::size_t settle = size / 4;
+		std::vector<double> capture(size);
+
+		ns = nanoseconds([&]
+		{
+			for (std::size_t f=0; f<settle+size; ++f)
+			{
+				if (syncIn) syncIn->value = 5.0f * static_cast<float>(std::sin(GTX__2PI * std::fmod(master * f / rate, 1.0)));
+
+				module->step();
+
+				if (f >= settle) capture[f - settle] = out.value;
+			}
+		}) / (settle + size);
+
+		return capture;
+	}
+
+	Result run(const std::string &slug, Shape shape, bool analog, Sync sync, float semitones)
+	{
+		double binHz = rate / static_cast<double>(size);
+		double pitch = 261.626 * std::pow(2.0, semitones / 12.0);
+		double master = std::max(1.0, std::round(pitch / RATIO / binHz)) * binHz;
+
+		Result result;
+		std::vector<double> capture = render(slug, shape, analog, sync, semitones, master, result.ns);
+
+		std::vector<std::complex<double>> x(size);
+		for (std::size_t i=0; i<size; ++i) x[i] = capture[i] * window[i];
+		fft(x);
+
+		std::vector<double> power(size / 2);
+		for (std::size_t i=0; i<size/2; ++i) power[i] = std::norm(x[i]);
+
+		// The period's frequency, refined for free running over a small search to follow analog drift
+		double period = sync == FREE ? pitch : sync == HARD ? master : master / 2;
+
+		if (sync == FREE) period = refine(power, period);
+
+		std::size_t count = static_cast<std::size_t>((size / 2 - BAND - 1) / (period / binHz));
+
+		std::vector<bool>   isSignal(size / 2, false);
+		std::vector<double> measured(count + 1, 0.0);
+
+		for (std::size_t k=1; k<=count; ++k)
+		{
+			long centre = std::lround(k * period / binHz);
+
+			for (long b=centre-BAND; b<=centre+BAND; ++b)
+			{
+				if (b < 0 || b >= long(size / 2) || isSignal[b]) continue;
+				isSignal[b] = true;
+				measured[k] += power[b];
+			}
+		}
+
+		double signal = 0.0, alias = 0.0, strongest = 0.0, worst = 0.0;
+
+		for (std::size_t b=BAND+1; b<size/2; ++b)
+		{
+			if (isSignal[b]) signal += power[b];
+			else
+			{
+				alias += power[b];
+				worst = std::max(worst, power[b]);
+			}
+		}
+
+		for (std::size_t k=1; k<=count; ++k) strongest = std::max(strongest, measured[k]);
+
+		result.alias = 10.0 * std::log10(alias / signal + 1e-30);
+		result.worst = 10.0 * std::log10(worst / strongest + 1e-30);
+		result.harm  = NAN;
+
+		if (sync != SOFT)
+		{
+			std::vector<double> reference = series(shape, analog, sync == HARD ? pitch / master : 1.0, count);
+
+			double m2 = 0.0, r2 = 0.0, e2 = 0.0;
+			for (std::size_t k=1; k<=count; ++k)
+			{
+				measured[k] = std::sqrt(measured[k]);
+				m2 += measured[k] * measured[k];
+				r2 += reference[k] * reference[k];
+			}
+
+			for (std::size_t k=1; k<=count; ++k)
+			{
+				double d = measured[k] / std::sqrt(m2) - reference[k] / std::sqrt(r2);
+				e2 += d * d;
+			}
+
+			result.harm = 10.0 * std::log10(e2 + 1e-30);
+		}
+
+		return result;
+	}
+
+	//! \brief The fundamental near 'nominal' whose harmonic bands hold the most power.
+	double refine(const std::vector<double> &power, double nominal) const
+	{
+		double binHz = rate / static_cast<double>(size);
+		double best = nominal, most = -1.0;
+
+		for (int step=-100; step<=100; ++step)
+		{
+			double f0 = nominal * (1.0 + step * 2e-5);
+			double sum = 0.0;
+
+			for (double h=f0; h/binHz < size/2 - BAND; h+=f0)
+			{
+				long b = std::lround(h / binHz);
+				sum += power[b - 1] + power[b] + power[b + 1];
+			}
+
+			if (sum > most)
+			{
+				most = sum;
+				best = f0;
+			}
+		}
+
+		return best;
+	}
+};
+
+
+//============================================================================================================
+
+int main(int argc, char *argv[])
+{
+	float rate = 44100.0f;
+	int   bits = 16;
+	std::vector<std::string> slugs;
+
+	for (int i=1; i<argc; ++i)
+	{
+		if      (!std::strcmp(argv[i], "-r") && i+1 < argc) rate = std::atof(argv[++i]);
+		else if (!std::strcmp(argv[i], "-n") && i+1 < argc) bits = std::atoi(argv[++i]);
+		else if (argv[i][0] == '-' || (std::strcmp(argv[i], "VCO-F1") && std::strcmp(argv[i], "VCO-F2")))
+		{
+			std::fprintf(stderr, "usage: %s [-r rate] [-n log2 size] [VCO-F1] [VCO-F2]\n", argv[0]);
+			return 1;
+		}
+		else slugs.push_back(argv[i]);
+	}
+
+	if (slugs.empty()) slugs = {"VCO-F1", "VCO-F2"};
+
+	static const float pitches[] = {-24.0f, 0.0f, 24.0f, 36.0f, 48.0f, 54.0f};  // Semitones from C4
+
+	Measure measure(std::size_t(1) << bits, rate);
+
+	for (const std::string &slug : slugs)
+	{
+		for (int analog=0; analog<2; ++analog)
+		{
+			for (int sync=0; sync<SYNCS; ++sync)
+			{
+				std::printf("\n%s, %s, %s\n", slug.c_str(), analog ? "analog" : "digital", syncNames[sync]);
+				std::printf("%-5s %9s %8s %8s %8s %8s\n", "wave", "pitch Hz", "alias", "worst", "harm", "ns");
+
+				for (int shape=0; shape<SHAPES; ++shape)
+				{
+					for (float semitones : pitches)
+					{
+						Measure::Result r = measure.run(slug, Shape(shape), analog, Sync(sync), semitones);
+
+						char harm[16] = "-";
+						if (!std::isnan(r.harm)) std::snprintf(harm, sizeof(harm), "%.1f", r.harm);
+
+						std::printf("%-5s %9.1f %8.1f %8.1f %8s %8.0f\n", shapeNames[shape],
+							261.626 * std::pow(2.0, semitones / 12.0), r.alias, r.worst, harm, r.ns);
+					}
+				}
+			}
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,104 @@
+//============================================================================================================
+//! \brief Accuracy report and micro-benchmark for src/FastMath.hpp, against libm.
+//!
+//! Needs no Rack, build and run with "make fastmath".  Errors are the worst over a dense sweep of each
+//! function's range, timings are nanoseconds per value over a block of 4096 lanes.
+
+#include "../src/FastMath.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+
+namespace fm = GTX::fastmath;
+
+
+static const std::size_t LANES  = 4096;
+static const int         ROUNDS = 2000;
+
+
+//============================================================================================================
+//! \brief Worst error of 'approx' against 'exact' over [lo, hi], relative or absolute.
+
+template <typename TApprox, typename TExact>
+double worst(TApprox approx, TExact exact, double lo, double hi, bool relative)
+{
+	double err = 0.0;
+
+	for (int i=0; i<=1000000; ++i)
+	{
+		float  x = static_cast<float>(lo + (hi - lo) * i / 1000000.0);
+		double e = exact(static_cast<double>(x));
+		double d = std::fabs(approx(x) - e);
+
+		if (relative) d /= std::fabs(e);
+		if (d > err) err = d;
+	}
+
+	return err;
+}
+
+
+//============================================================================================================
+//! \brief Nanoseconds per value of 'f' over a block of lanes, kept alive through a checksum.
+
+static volatile float sink;
+
+template <typename TFunc>
+double timing(TFunc f, float lo, float hi)
+{
+	std::vector<float> in(LANES), out(LANES);
+
+	for (std::size_t k=0; k<LANES; ++k) in[k] = lo + (hi - lo) * k / LANES;
+
+	auto start = std::chrono::steady_clock::now();
+
+	for (int r=0; r<ROUNDS; ++r)
+	{
+		for (std::size_t k=0; k<LANES; ++k) out[k] = f(in[k]);
+
+		sink = out[r % LANES];
+	}
+
+	auto stop = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::nano>(stop - start).count() / (double(LANES) * ROUNDS);
+}
+
+
+//============================================================================================================
+
+template <int P> void report(const char *tier)
+{
+	std::printf("%-7s exp2    %9.2e rel %7.3f ns\n", tier,
+		worst([](float x) { return fm::exp2<P>(x); }, [](double x) { return std::exp2(x); }, -125.0, 126.0, true),
+		timing([](float x) { return fm::exp2<P>(x); }, -10.0f, 10.0f));
+
+	std::printf("%-7s log2    %9.2e abs %7.3f ns\n", tier,
+		worst([](float x) { return fm::log2<P>(x); }, [](double x) { return std::log2(x); }, 0.5, 2.0, false),
+		timing([](float x) { return fm::log2<P>(x); }, 1e-3f, 1e3f));
+
+	std::printf("%-7s sin2pi  %9.2e abs %7.3f ns\n", tier,
+		worst([](float p) { return fm::sin2pi<P>(p); }, [](double p) { return std::sin(2.0 * M_PI * p); }, -64.0, 64.0, false),
+		timing([](float p) { return fm::sin2pi<P>(p); }, 0.0f, 1.0f));
+
+	std::printf("%-7s tanh    %9.2e abs %7.3f ns\n", tier,
+		worst([](float x) { return fm::tanh<P>(x); }, [](double x) { return std::tanh(x); }, -20.0, 20.0, false),
+		timing([](float x) { return fm::tanh<P>(x); }, -4.0f, 4.0f));
+}
+
+int main()
+{
+	std::printf("libm    powf                %7.3f ns\n", timing([](float x) { return powf(2.0f, x); }, -10.0f, 10.0f));
+	std::printf("libm    logf                %7.3f ns\n", timing([](float x) { return logf(x); }, 1e-3f, 1e3f));
+	std::printf("libm    sinf                %7.3f ns\n", timing([](float p) { return sinf(2.0f * float(M_PI) * p); }, 0.0f, 1.0f));
+	std::printf("libm    tanhf               %7.3f ns\n", timing([](float x) { return tanhf(x); }, -4.0f, 4.0f));
+
+	report<fm::COARSE>("COARSE");
+	report<fm::MEDIUM>("MEDIUM");
+	report<fm::FINE  >("FINE");
+
+	return 0;
+}
@@ -0,0 +1,58 @@
+//============================================================================================================
+//! \brief The modules of the golden patches as they were before the DSP work, for "make golden-baseline".
+//!
+//! The Makefile unpacks the sources of GOLDEN_BASE into build/golden/src and builds this with them on the
+//! include path, then links it with bench/render.cpp in place of the DSP library.  The old sources sit in
+//! a namespace of their own so that nothing in them can meet the same names of the current tree in the
+//! renderer, and init() is the one from here, registering only the modules the golden patches use.
+
+#include "rack.hpp"
+#include "dsp/decimator.hpp"
+#include "dsp/digital.hpp"
+#include "dsp/filter.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <list>
+#include <sstream>
+#include <string>
+#include <string.h>
+
+
+namespace Baseline {
+
+
+#include "Gratrix.hpp"
+
+Plugin *plugin;
+
+#include "VCO.cpp"
+#include "VCF.cpp"
+#include "VCA.cpp"
+#include "ADSR.cpp"
+#include "Fade-G1.cpp"
+
+
+} // Baseline
+
+
+rack::Plugin *plugin;
+
+void init(rack::Plugin *p)
+{
+	::plugin = Baseline::plugin = p;
+	p->slug = TOSTRING(SLUG);
+	p->version = TOSTRING(VERSION);
+
+	p->addModel(Baseline::GTX::VCO_F1::model);
+	p->addModel(Baseline::GTX::VCO_F2::model);
+	p->addModel(Baseline::GTX::VCF_F1::model);
+	p->addModel(Baseline::GTX::VCA_F1::model);
+	p->addModel(Baseline::GTX::ADSR_F1::model);
+	p->addModel(Baseline::GTX::Fade_G1::model);
+}
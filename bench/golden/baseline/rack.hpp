@@ -0,0 +1,295 @@
+#ifndef GTX__GOLDEN_BASELINE_RACK_HPP
+#define GTX__GOLDEN_BASELINE_RACK_HPP
+
+
+//============================================================================================================
+//! \brief The shim with the widgets the baseline sources build, none of them doing anything.
+//!
+//! The sources the golden references are rendered from predate GTX__WIDGETS=0, so their panels are built
+//! too.  Only the modules are ever made, the widget code need only compile and link.
+
+#include "../../../shim/rack.hpp"
+
+#include <cstring>
+#include <memory>
+
+
+#define CHECKMARK_STRING "\xE2\x9C\x94"
+#define CHECKMARK(_cond) ((_cond) ? CHECKMARK_STRING : "")
+
+
+//============================================================================================================
+//! \name NanoVG, drawing nothing.
+
+typedef struct NVGcontext NVGcontext;
+struct NVGcolor { float r, g, b, a; };
+
+enum NVGlineCap { NVG_BUTT, NVG_ROUND, NVG_SQUARE };
+enum NVGcompositeOperation { NVG_SOURCE_OVER, NVG_LIGHTER };
+
+inline NVGcolor nvgRGB (unsigned char r, unsigned char g, unsigned char b)                  { return {r/255.f, g/255.f, b/255.f, 1.f}; }
+inline NVGcolor nvgRGBA(unsigned char r, unsigned char g, unsigned char b, unsigned char a) { return {r/255.f, g/255.f, b/255.f, a/255.f}; }
+
+inline void  nvgSave(NVGcontext *) {}
+inline void  nvgRestore(NVGcontext *) {}
+inline void  nvgScissor(NVGcontext *, float, float, float, float) {}
+inline void  nvgResetScissor(NVGcontext *) {}
+inline void  nvgBeginPath(NVGcontext *) {}
+inline void  nvgClosePath(NVGcontext *) {}
+inline void  nvgMoveTo(NVGcontext *, float, float) {}
+inline void  nvgLineTo(NVGcontext *, float, float) {}
+inline void  nvgRect(NVGcontext *, float, float, float, float) {}
+inline void  nvgCircle(NVGcontext *, float, float, float) {}
+inline void  nvgLineCap(NVGcontext *, int) {}
+inline void  nvgMiterLimit(NVGcontext *, float) {}
+inline void  nvgStrokeWidth(NVGcontext *, float) {}
+inline void  nvgGlobalCompositeOperation(NVGcontext *, int) {}
+inline void  nvgStrokeColor(NVGcontext *, NVGcolor) {}
+inline void  nvgFillColor(NVGcontext *, NVGcolor) {}
+inline void  nvgStroke(NVGcontext *) {}
+inline void  nvgFill(NVGcontext *) {}
+inline void  nvgFontSize(NVGcontext *, float) {}
+inline void  nvgFontFaceId(NVGcontext *, int) {}
+inline void  nvgTextLetterSpacing(NVGcontext *, float) {}
+inline float nvgText(NVGcontext *, float x, float, const char *, const char *) { return x; }
+
+
+namespace rack {
+
+
+inline float eucmod(float a, float base)
+{
+	float mod = std::fmod(a, base);
+	return (mod < 0.f) ? mod + base : mod;
+}
+
+
+//============================================================================================================
+//! \name Widgets, as widgets.hpp, app.hpp and componentlibrary.hpp.
+
+struct Vec
+{
+	float x = 0.f, y = 0.f;
+
+	Vec() {}
+	Vec(float x, float y) : x(x), y(y) {}
+
+	Vec plus (Vec b) const { return Vec(x + b.x, y + b.y); }
+	Vec minus(Vec b) const { return Vec(x - b.x, y - b.y); }
+	Vec mult (float s) const { return Vec(x * s, y * s); }
+	Vec round() const { return Vec(std::round(x), std::round(y)); }
+};
+
+struct Rect
+{
+	Vec pos, size;
+
+	Rect() {}
+	Rect(Vec pos, Vec size) : pos(pos), size(size) {}
+};
+
+struct EventAction { bool consumed = false; };
+
+struct Font
+{
+	int handle = 0;
+	static std::shared_ptr<Font> load(const std::string &) { return std::make_shared<Font>(); }
+};
+
+struct SVG
+{
+	static std::shared_ptr<SVG> load(const std::string &) { return nullptr; }
+};
+
+inline std::string assetGlobal(std::string filename) { return filename; }
+inline std::string assetLocal (std::string filename) { return filename; }
+inline std::string assetPlugin(Plugin *, std::string filename) { return filename; }
+
+struct Widget
+{
+	Rect box;
+	Widget *parent = nullptr;
+	std::list<Widget *> children;
+	bool visible = true;
+
+	virtual ~Widget()
+	{
+		for (Widget *child : children) delete child;
+	}
+
+	virtual void step() {}
+	virtual void draw(NVGcontext *) {}
+	virtual void onAction(EventAction &) {}
+
+	void addChild(Widget *widget)
+	{
+		widget->parent = this;
+		children.push_back(widget);
+	}
+
+	template <class T>
+	static T *create(Vec pos)
+	{
+		T *o = new T();
+		o->box.pos = pos;
+		return o;
+	}
+};
+
+struct TransparentWidget : Widget {};
+struct OpaqueWidget : Widget {};
+
+struct MenuEntry : OpaqueWidget
+{
+	std::string text;
+
+	template <typename T = MenuEntry>
+	static T *create() { return new T(); }
+};
+
+struct MenuLabel : MenuEntry
+{
+	template <typename T = MenuLabel>
+	static T *create(std::string text)
+	{
+		T *o = new T();
+		o->text = text;
+		return o;
+	}
+};
+
+struct MenuItem : MenuEntry
+{
+	std::string rightText;
+
+	template <typename T = MenuItem>
+	static T *create(std::string text, std::string rightText = "")
+	{
+		T *o = new T();
+		o->text = text;
+		o->rightText = rightText;
+		return o;
+	}
+};
+
+struct Menu : OpaqueWidget
+{
+	void pushChild(Widget *widget) { addChild(widget); }
+};
+
+struct SVGWidget : Widget
+{
+	std::shared_ptr<SVG> svg;
+	void wrap() {}
+	void setSVG(std::shared_ptr<SVG> svg) { this->svg = svg; }
+};
+
+struct ParamWidget : OpaqueWidget
+{
+	Module *module = nullptr;
+	int paramId = 0;
+	float value = 0.f, minValue = 0.f, maxValue = 1.f, defaultValue = 0.f;
+	bool snap = false;
+
+	void setValue(float value) { this->value = value; }
+
+	template <class T>
+	static T *create(Vec pos, Module *module, int paramId, float minValue, float maxValue, float defaultValue)
+	{
+		T *o = Widget::create<T>(pos);
+		o->module = module;
+		o->paramId = paramId;
+		o->minValue = minValue;
+		o->maxValue = maxValue;
+		o->defaultValue = defaultValue;
+		o->value = defaultValue;
+		return o;
+	}
+};
+
+struct Knob : ParamWidget { float minAngle = 0.f, maxAngle = 0.f; };
+struct SVGKnob : Knob { void setSVG(std::shared_ptr<SVG>) {} };
+struct RoundKnob : SVGKnob {};
+struct SVGSwitch : ParamWidget { void addFrame(std::shared_ptr<SVG>) {} };
+struct ToggleSwitch : SVGSwitch {};
+struct MomentarySwitch : SVGSwitch {};
+struct CKSS : SVGSwitch {};
+struct LEDButton : SVGSwitch {};
+
+struct Port : OpaqueWidget
+{
+	enum PortType { INPUT, OUTPUT };
+
+	Module *module = nullptr;
+	PortType type = INPUT;
+	int portId = 0;
+
+	template <class T>
+	static T *create(Vec pos, PortType type, Module *module, int portId)
+	{
+		T *o = Widget::create<T>(pos);
+		o->type = type;
+		o->module = module;
+		o->portId = portId;
+		return o;
+	}
+};
+
+struct SVGPort : Port
+{
+	SVGWidget *background;
+
+	SVGPort() : background(new SVGWidget()) { addChild(background); }
+};
+
+struct SVGScrew : Widget {};
+struct ScrewSilver : SVGScrew {};
+
+struct ModuleLightWidget : Widget
+{
+	Module *module = nullptr;
+	int firstLightId = 0;
+
+	void addBaseColor(NVGcolor) {}
+
+	template <class T>
+	static T *create(Vec pos, Module *module, int firstLightId)
+	{
+		T *o = Widget::create<T>(pos);
+		o->module = module;
+		o->firstLightId = firstLightId;
+		return o;
+	}
+};
+
+struct GrayModuleLightWidget : ModuleLightWidget {};
+struct RedLight : GrayModuleLightWidget {};
+struct GreenLight : GrayModuleLightWidget {};
+struct YellowLight : GrayModuleLightWidget {};
+struct BlueLight : GrayModuleLightWidget {};
+struct GreenRedLight : GrayModuleLightWidget {};
+struct RedGreenBlueLight : GrayModuleLightWidget {};
+template <typename T> struct TinyLight : T {};
+template <typename T> struct SmallLight : T {};
+template <typename T> struct MediumLight : T {};
+template <typename T> struct LargeLight : T {};
+
+struct ModuleWidget : OpaqueWidget
+{
+	Model *model = nullptr;
+	Module *module = nullptr;
+
+	ModuleWidget(Module *module) : module(module) {}
+
+	void setPanel(std::shared_ptr<SVG>) {}
+	void addInput (Port *port)         { addChild(port); }
+	void addOutput(Port *port)         { addChild(port); }
+	void addParam (ParamWidget *param) { addChild(param); }
+	virtual void appendContextMenu(Menu *) {}
+};
+
+
+} // rack
+
+
+#endif
@@ -0,0 +1,271 @@
+//============================================================================================================
+//! \brief Per-module benchmark, every input patched to a fixed stimulus, no GUI.
+//!
+//! Build and run with "make bench", or run build/bench directly:
+//!
+//!   build/bench [-s seconds] [-r rate] [-n repeats] [-j json ...] [-w out.json] [-c baseline.json [-x %]] [slug ...]
+//!
+//! Each module runs 'seconds' of audio (default 2) at 'rate' (default 44100) after a tenth of that to warm
+//! up, with its state loaded from 'json' if given, e.g. -j '{"block_size": 32}'.  Several -j run every
+//! module once per configuration it takes, an empty one being the module as made.  Without slugs every
+//! model of the plugin but the blanks is run.  Voices per core is how many voices one core keeps up with
+//! in real time, for banks the bank size times the instances per core.  Given 'repeats' each figure is
+//! the fastest of that many runs, which steadies it against the rest of the machine.
+//!
+//! With -w the results are written as JSON, one entry of ns/sample per module and configuration.  With
+//! -c the modules and configurations of such a file are run instead, at its rate, only those of the slugs
+//! if any are given, and any more than 'x' percent (default 10) slower than the file says is flagged,
+//! the exit status then being 2.
+//! "make bench-baseline" writes build/bench-baseline.json and "make bench-compare" checks against it.
+//! Times belong to the machine that made them, so the baseline is recorded on the machine that compares,
+//! from the tree before the change, and is never checked in.
+//!
+//! A configuration with "voice_threads" splits a bank's voices over that many cores, its ns/sample then
+//! being wall-clock time for the whole bank and voices per core per audio thread.  "make bench-threads"
+//! runs the large banks on one, two and four, to show how they scale with the cores the machine has.
+
+#include "Headless.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+
+using namespace GTX::Headless;
+
+
+//============================================================================================================
+//! \brief One module in one configuration.
+
+struct Entry
+{
+	std::string slug;
+	std::string config;
+	double ns = 0.0;  // Per sample
+};
+
+//! \brief Fastest of 'repeats' runs of 'seconds' of audio, in nanoseconds per sample.
+static double measure(const Entry &entry, float rate, double seconds, int repeats)
+{
+	std::size_t frames = static_cast<std::size_t>(seconds * rate);
+	double best = 0.0;
+
+	for (int r=0; r<repeats; ++r)
+	{
+		Rig rig(entry.slug, rate, entry.config);
+
+		rig.run(frames / 10);
+
+		double ns = nanoseconds([&] { rig.run(frames); }) / frames;
+
+		if (r == 0 || ns < best) best = ns;
+	}
+
+	return best;
+}
+
+//! \brief Whether 'config' changes the saved state of the module, modules ignore settings they lack.
+static bool applies(const Entry &entry, float rate)
+{
+	if (entry.config.empty()) return true;
+
+	Rig plain (entry.slug, rate);
+	Rig config(entry.slug, rate, entry.config);
+
+	json_t *plainJ  = plain .module->toJson();
+	json_t *configJ = config.module->toJson();
+
+	bool differs = plainJ && configJ && !json_equal(plainJ, configJ);
+
+	json_decref(plainJ);
+	json_decref(configJ);
+
+	return differs;
+}
+
+static bool write(const char *path, const std::vector<Entry> &entries, float rate)
+{
+	json_t *resultsJ = json_array();
+
+	for (const Entry &entry : entries)
+	{
+		json_t *entryJ = json_object();
+		json_object_set_new(entryJ, "module", json_string(entry.slug.c_str()));
+		json_object_set_new(entryJ, "config", json_string(entry.config.c_str()));
+		json_object_set_new(entryJ, "ns",     json_real(entry.ns));
+		json_array_append_new(resultsJ, entryJ);
+	}
+
+	json_t *rootJ = json_object();
+	json_object_set_new(rootJ, "rate",    json_real(rate));
+	json_object_set_new(rootJ, "results", resultsJ);
+
+	bool ok = json_dump_file(rootJ, path, JSON_INDENT(1) | JSON_PRESERVE_ORDER | JSON_REAL_PRECISION(5)) == 0;
+	json_decref(rootJ);
+
+	if (!ok) std::fprintf(stderr, "could not write %s\n", path);
+
+	return ok;
+}
+
+static bool read(const char *path, std::vector<Entry> &entries, float &rate)
+{
+	json_error_t error;
+	json_t *rootJ = json_load_file(path, 0, &error);
+
+	if (!rootJ)
+	{
+		std::fprintf(stderr, "%s:%d: %s\n", path, error.line, error.text);
+		return false;
+	}
+
+	if (json_t *rateJ = json_object_get(rootJ, "rate")) rate = json_number_value(rateJ);
+
+	std::size_t i;
+	json_t *entryJ;
+
+	json_array_foreach(json_object_get(rootJ, "results"), i, entryJ)
+	{
+		const char *slug   = json_string_value(json_object_get(entryJ, "module"));
+		const char *config = json_string_value(json_object_get(entryJ, "config"));
+
+		Entry entry;
+		entry.slug   = slug   ? slug   : "";
+		entry.config = config ? config : "";
+		entry.ns     = json_number_value(json_object_get(entryJ, "ns"));
+		entries.push_back(entry);
+	}
+
+	json_decref(rootJ);
+	return true;
+}
+
+
+//============================================================================================================
+
+int main(int argc, char *argv[])
+{
+	double seconds  = 2.0;
+	float  rate     = 44100.0f;
+	int    repeats  = 1;
+	double percent  = 10.0;
+	const char *out      = nullptr;
+	const char *baseline = nullptr;
+	std::vector<std::string> configs;
+	std::vector<std::string> slugs;
+
+	for (int i=1; i<argc; ++i)
+	{
+		if      (!std::strcmp(argv[i], "-s") && i+1 < argc) seconds  = std::atof(argv[++i]);
+		else if (!std::strcmp(argv[i], "-r") && i+1 < argc) rate     = std::atof(argv[++i]);
+		else if (!std::strcmp(argv[i], "-n") && i+1 < argc) repeats  = std::max(1, std::atoi(argv[++i]));
+		else if (!std::strcmp(argv[i], "-j") && i+1 < argc) configs.push_back(argv[++i]);
+		else if (!std::strcmp(argv[i], "-w") && i+1 < argc) out      = argv[++i];
+		else if (!std::strcmp(argv[i], "-c") && i+1 < argc) baseline = argv[++i];
+		else if (!std::strcmp(argv[i], "-x") && i+1 < argc) percent  = std::atof(argv[++i]);
+		else if (argv[i][0] == '-')
+		{
+			std::fprintf(stderr, "usage: %s [-s seconds] [-r rate] [-n repeats] [-j json ...] [-w out.json] [-c baseline.json [-x %%]] [slug ...]\n", argv[0]);
+			return 1;
+		}
+		else slugs.push_back(argv[i]);
+	}
+
+	std::vector<Entry> expected;
+
+	if (baseline && !read(baseline, expected, rate)) return 1;
+
+	if (baseline && !slugs.empty())
+	{
+		expected.erase(std::remove_if(expected.begin(), expected.end(), [&](const Entry &entry)
+		{
+			return std::find(slugs.begin(), slugs.end(), entry.slug) == slugs.end();
+		}), expected.end());
+	}
+
+	if (slugs.empty() && !baseline)
+	{
+		for (rack::Model *m : load().models)
+		{
+			bool blank = false;
+			for (rack::ModelTag tag : m->tags) blank = blank || tag == rack::BLANK_TAG;
+			if (!blank) slugs.push_back(m->slug);
+		}
+	}
+
+	if (configs.empty()) configs.push_back("");
+
+	// What to run, the baseline's entries when comparing
+	std::vector<Entry> entries;
+
+	if (baseline)
+	{
+		entries = expected;
+	}
+	else
+	{
+		for (const std::string &config : configs)
+		{
+			for (const std::string &slug : slugs)
+			{
+				Entry entry;
+				entry.slug   = slug;
+				entry.config = config;
+				if (applies(entry, rate)) entries.push_back(entry);
+			}
+		}
+	}
+
+	if (baseline)
+	{
+		std::printf("%-16s %-40s %12s %12s %8s\n", "module", "config", "ns/sample", "baseline", "change");
+	}
+	else
+	{
+		std::printf("%-16s %-40s %6s %12s %14s %12s\n", "module", "config", "voices", "ns/sample", "samples/sec", "voices/core");
+	}
+
+	std::size_t regressions = 0;
+
+	for (std::size_t e=0; e<entries.size(); ++e)
+	{
+		Entry &entry = entries[e];
+
+		if (baseline && !load().getModel(entry.slug))
+		{
+			std::printf("%-16s %-40s missing\n", entry.slug.c_str(), entry.config.c_str());
+			++regressions;
+			continue;
+		}
+
+		entry.ns = measure(entry, rate, seconds, repeats);
+
+		if (baseline)
+		{
+			double change = 100.0 * (entry.ns / expected[e].ns - 1.0);
+			bool   slower = change > percent;
+
+			std::printf("%-16s %-40s %12.1f %12.1f %+7.1f%%%s\n", entry.slug.c_str(), entry.config.c_str(),
+				entry.ns, expected[e].ns, change, slower ? "  REGRESSION" : "");
+
+			regressions += slower;
+		}
+		else
+		{
+			double perSec   = 1e9 / entry.ns;
+			std::size_t n   = voices(entry.slug);
+
+			std::printf("%-16s %-40s %6zu %12.1f %14.0f %12.0f\n", entry.slug.c_str(), entry.config.c_str(),
+				n, entry.ns, perSec, n * perSec / rate);
+		}
+	}
+
+	if (out && !write(out, entries, rate)) return 1;
+
+	if (regressions)
+	{
+		std::printf("%zu of %zu missing or over %g%% slower than %s\n", regressions, entries.size(), percent, baseline);
+		return 2;
+	}
+
+	return 0;
+}
@@ -0,0 +1,469 @@
+//============================================================================================================
+//! \brief Offline renderer, runs a patch of Gratrix modules as fast as the CPU allows.
+//!
+//! Build with "make render", then:
+//!
+//!   build/render [-t seconds] [-r rate] [-j [module:]json] [-o module:output ...] [-c reference [-e dB] [-d frames]] [-T trace.json] patch.vcv [out]
+//!
+//! The patch is a Rack 0.6 patch file, or any JSON with the same "modules" and "wires".  Of each module
+//! only "plugin", "model", "params" and "data" are read, modules of other plugins are left out along with
+//! their wires.  The channels written are the outputs given by -o, module index then output id, or else
+//! whatever is wired into the inputs of a Core AudioInterface, channel per input.  Samples are volts over
+//! ten as the audio interface scales them, written as 32-bit float WAV, or interleaved raw floats for any
+//! other extension.  Wires carry a sample of delay as in Rack's engine, so renders match the real thing.
+//!
+//! With -j the keys of 'json' are set in the "data" of every Gratrix module before it is loaded, so that
+//! -j '{"block_size": 32}' renders the patch as if each module had been set so from its menu.  Led by a
+//! module index and a colon only that module is set.
+//!
+//! With -c the render is checked against an earlier one, a WAV or raw file of the same channels, and the
+//! exit status is 2 if any channel differs.  Given -e a channel passes when its signal to difference
+//! ratio is at least that many dB, which suits approximations, without it only bit-exact output passes.
+//! Given -d the reference is taken as that many frames later, silent before, for settings that delay.
+//! Random numbers start from the same seed every run, so a patch renders the same until its code
+//! changes.  This is how to guard DSP work: render a reference from a stimulus patch before, compare after.
+//! "make golden" does so for the patches in bench/golden, at 44.1 and 96 kHz, with a tolerance per module,
+//! then checks that the settings which should not change a sample do not, rendering again with -j.
+//!
+//! With -T every module's steps are traced as from the context menu, to open in chrome://tracing or
+//! Perfetto.  Rendering runs faster than real time, so expect the trace to note steps dropped.
+
+#include "Headless.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+
+using namespace GTX::Headless;
+
+
+//============================================================================================================
+//! \brief Modules and wires of a patch, stepped the way Rack's engine steps them.
+
+struct Graph
+{
+	struct Wire
+	{
+		rack::Output *from;
+		rack::Input  *to;
+	};
+
+	struct Tap
+	{
+		int module;
+		int output;
+	};
+
+	std::vector<std::unique_ptr<rack::Module>> modules;  // By patch index, null where not ours
+	std::vector<Wire> wires;
+	std::vector<Tap>  taps;                               // Audio interface inputs, by channel
+	json_t *data = nullptr;                               // Given by -j, set over each module's own
+	int dataModule = -1;                                  // The module -j is for, -1 for all
+
+	void read(json_t *rootJ)
+	{
+		json_t *modulesJ = json_object_get(rootJ, "modules");
+		json_t *wiresJ   = json_object_get(rootJ, "wires");
+
+		for (std::size_t i=0; i<json_array_size(modulesJ); ++i)
+		{
+			json_t     *moduleJ = json_array_get(modulesJ, i);
+			const char *plugin  = json_string_value(json_object_get(moduleJ, "plugin"));
+			const char *slug    = json_string_value(json_object_get(moduleJ, "model"));
+			rack::Model *model  = (plugin && slug && load().slug == plugin) ? load().getModel(slug) : nullptr;
+
+			modules.emplace_back(model ? model->createModule() : nullptr);
+
+			if (!model)
+			{
+				if (!isAudioInterface(moduleJ))
+				{
+					std::fprintf(stderr, "leaving out module %zu (%s %s)\n", i, plugin ? plugin : "?", slug ? slug : "?");
+				}
+				continue;
+			}
+
+			rack::Module &module = *modules.back();
+			json_t *paramsJ = json_object_get(moduleJ, "params");
+
+			for (std::size_t p=0; p<json_array_size(paramsJ); ++p)
+			{
+				json_t *paramJ = json_array_get(paramsJ, p);
+				json_t *idJ    = json_object_get(paramJ, "paramId");
+				std::size_t id = idJ ? json_integer_value(idJ) : p;
+
+				if (id < module.params.size())
+				{
+					module.params[id].value = json_number_value(json_object_get(paramJ, "value"));
+				}
+			}
+
+			json_t *extraJ = (dataModule < 0 || dataModule == static_cast<int>(i)) ? data : nullptr;
+
+			if (json_t *dataJ = json_object_get(moduleJ, "data"))
+			{
+				if (extraJ) json_object_update(dataJ, extraJ);
+				module.fromJson(dataJ);
+			}
+			else if (extraJ)
+			{
+				module.fromJson(extraJ);
+			}
+		}
+
+		for (std::size_t i=0; i<json_array_size(wiresJ); ++i)
+		{
+			json_t *wireJ = json_array_get(wiresJ, i);
+
+			std::size_t fromModule = json_integer_value(json_object_get(wireJ, "outputModuleId"));
+			std::size_t fromPort   = json_integer_value(json_object_get(wireJ, "outputId"));
+			std::size_t toModule   = json_integer_value(json_object_get(wireJ, "inputModuleId"));
+			std::size_t toPort     = json_integer_value(json_object_get(wireJ, "inputId"));
+
+			if (fromModule >= modules.size() || !modules[fromModule]) continue;
+
+			rack::Module &from = *modules[fromModule];
+			if (fromPort >= from.outputs.size()) continue;
+
+			if (toModule < modules.size() && modules[toModule])
+			{
+				rack::Module &to = *modules[toModule];
+				if (toPort >= to.inputs.size()) continue;
+
+				from.outputs[fromPort].active = true;
+				to.inputs[toPort].active = true;
+				wires.push_back({&from.outputs[fromPort], &to.inputs[toPort]});
+			}
+			else if (toModule < modules.size() && isAudioInterface(json_array_get(modulesJ, toModule)))
+			{
+				from.outputs[fromPort].active = true;
+				if (taps.size() <= toPort) taps.resize(toPort + 1, {-1, -1});
+				taps[toPort] = {static_cast<int>(fromModule), static_cast<int>(fromPort)};
+			}
+		}
+	}
+
+	static bool isAudioInterface(json_t *moduleJ)
+	{
+		const char *slug = json_string_value(json_object_get(moduleJ, "model"));
+		return slug && !std::strcmp(slug, "AudioInterface");
+	}
+
+	void step()
+	{
+		for (auto &module : modules)
+		{
+			if (module) module->step();
+		}
+
+		for (Wire &wire : wires)
+		{
+			wire.to->value = wire.from->value;
+		}
+	}
+
+	//! \brief The output a tap reads, null for a channel nothing is wired to.
+	rack::Output *output(const Tap &tap)
+	{
+		if (tap.module < 0 || tap.module >= static_cast<int>(modules.size()) || !modules[tap.module]) return nullptr;
+
+		rack::Module &module = *modules[tap.module];
+		return tap.output < static_cast<int>(module.outputs.size()) ? &module.outputs[tap.output] : nullptr;
+	}
+};
+
+
+//============================================================================================================
+//! \brief Writes interleaved float frames as a 32-bit float WAV or as raw floats.
+
+struct Writer
+{
+	std::ofstream file;
+	bool wav;
+	std::size_t channels;
+	float rate;
+	std::uint32_t bytes = 0;
+
+	Writer(const char *path, std::size_t channels, float rate)
+	:
+		file(path, std::ios::binary),
+		channels(channels),
+		rate(rate)
+	{
+		std::size_t n = std::strlen(path);
+		wav = n >= 4 && !std::strcmp(path + n - 4, ".wav");
+
+		if (wav) header();
+	}
+
+	~Writer()
+	{
+		if (wav)
+		{
+			file.seekp(0);
+			header();
+		}
+	}
+
+	void put16(std::uint16_t v) { file.put(v & 255).put(v >> 8); }
+	void put32(std::uint32_t v) { put16(v & 0xFFFF); put16(v >> 16); }
+
+	void header()
+	{
+		file.write("RIFF", 4);  put32(36 + bytes);
+		file.write("WAVE", 4);
+		file.write("fmt ", 4);  put32(16);
+		put16(3);  // IEEE float
+		put16(channels);
+		put32(rate);
+		put32(rate * channels * 4);
+		put16(channels * 4);
+		put16(32);
+		file.write("data", 4);  put32(bytes);
+	}
+
+	void write(const float *frames, std::size_t count)
+	{
+		file.write(reinterpret_cast<const char *>(frames), count * channels * sizeof(float));
+		bytes += count * channels * sizeof(float);
+	}
+};
+
+
+//============================================================================================================
+//! \brief Reads a file written by Writer, the data chunk of a WAV or all of a raw file.
+
+std::vector<float> readFloats(const char *path)
+{
+	std::ifstream file(path, std::ios::binary);
+	std::vector<char> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	std::size_t begin = 0, end = bytes.size();
+
+	if (bytes.size() >= 12 && !std::memcmp(&bytes[0], "RIFF", 4) && !std::memcmp(&bytes[8], "WAVE", 4))
+	{
+		for (std::size_t at=12; at+8<=bytes.size(); )
+		{
+			std::uint32_t size;
+			std::memcpy(&size, &bytes[at + 4], 4);
+
+			if (!std::memcmp(&bytes[at], "data", 4))
+			{
+				begin = at + 8;
+				end   = std::min<std::size_t>(begin + size, bytes.size());
+				break;
+			}
+
+			at += 8 + size + (size & 1);
+		}
+	}
+
+	std::vector<float> floats((end - begin) / sizeof(float));
+	if (!floats.empty()) std::memcpy(floats.data(), &bytes[begin], floats.size() * sizeof(float));
+	return floats;
+}
+
+
+//============================================================================================================
+//! \brief Per channel difference from a reference render.
+
+struct Compare
+{
+	std::vector<float> reference;
+	std::size_t channels;
+	std::size_t lag;
+	std::size_t frame = 0;
+	std::vector<double> signal, error, worst;
+
+	Compare(const char *path, std::size_t channels, std::size_t lag)
+	:
+		reference(readFloats(path)),
+		channels(channels),
+		lag(lag),
+		signal(channels),
+		error(channels),
+		worst(channels)
+	{}
+
+	void add(const float *frames, std::size_t count)
+	{
+		for (std::size_t f=0; f<count; ++f, ++frame)
+		{
+			for (std::size_t c=0; c<channels; ++c)
+			{
+				std::size_t at = (frame - lag) * channels + c;
+				double ref = (frame >= lag && at < reference.size()) ? reference[at] : 0.0;
+				double d   = frames[f * channels + c] - ref;
+
+				signal[c] += ref * ref;
+				error[c]  += d * d;
+				worst[c]   = std::max(worst[c], std::fabs(d));
+			}
+		}
+	}
+
+	//! \brief Prints each channel, true if all pass.  A negative 'dB' asks for bit-exact output.
+	bool report(double dB)
+	{
+		bool pass = reference.size() == frame * channels;
+
+		if (!pass)
+		{
+			std::fprintf(stderr, "reference has %zu frames, render has %zu\n", reference.size() / channels, frame);
+		}
+
+		for (std::size_t c=0; c<channels; ++c)
+		{
+			double snr = error[c] > 0.0 ? 10.0 * std::log10(signal[c] / error[c]) : INFINITY;
+			bool   ok  = dB < 0.0 ? error[c] == 0.0 : snr >= dB;
+
+			std::fprintf(stderr, "channel %zu: max difference %.3g, %.1f dB, %s\n", c, worst[c], snr, ok ? "pass" : "FAIL");
+			pass = pass && ok;
+		}
+
+		return pass;
+	}
+};
+
+
+//============================================================================================================
+
+int main(int argc, char *argv[])
+{
+	double seconds = 10.0;
+	float  rate    = 44100.0f;
+	std::vector<Graph::Tap> taps;
+	std::vector<const char *> paths;
+	const char *reference = nullptr;
+	const char *trace     = nullptr;
+	const char *data      = nullptr;
+	int    dataModule = -1;
+	double dB = -1.0;
+	std::size_t lag = 0;
+	bool usage = false;
+
+	for (int i=1; i<argc; ++i)
+	{
+		Graph::Tap tap;
+
+		if      (!std::strcmp(argv[i], "-t") && i+1 < argc) seconds = std::atof(argv[++i]);
+		else if (!std::strcmp(argv[i], "-r") && i+1 < argc) rate    = std::atof(argv[++i]);
+		else if (!std::strcmp(argv[i], "-c") && i+1 < argc) reference = argv[++i];
+		else if (!std::strcmp(argv[i], "-e") && i+1 < argc) dB      = std::atof(argv[++i]);
+		else if (!std::strcmp(argv[i], "-d") && i+1 < argc) lag     = std::atoi(argv[++i]);
+		else if (!std::strcmp(argv[i], "-j") && i+1 < argc)
+		{
+			data = argv[++i];
+			if (std::sscanf(data, "%d:", &dataModule) == 1) data = std::strchr(data, ':') + 1;
+		}
+		else if (!std::strcmp(argv[i], "-T") && i+1 < argc) trace   = argv[++i];
+		else if (!std::strcmp(argv[i], "-o") && i+1 < argc)
+		{
+			usage = usage || std::sscanf(argv[++i], "%d:%d", &tap.module, &tap.output) != 2;
+			taps.push_back(tap);
+		}
+		else if (argv[i][0] != '-') paths.push_back(argv[i]);
+		else usage = true;
+	}
+
+	if (usage || paths.size() < (reference ? 1 : 2) || paths.size() > 2)
+	{
+		std::fprintf(stderr, "usage: %s [-t seconds] [-r rate] [-j [module:]json] [-o module:output ...] [-c reference [-e dB] [-d frames]] [-T trace.json] patch.vcv [out]\n", argv[0]);
+		return 1;
+	}
+
+	json_error_t error;
+	json_t *rootJ = json_load_file(paths[0], 0, &error);
+
+	if (!rootJ)
+	{
+		std::fprintf(stderr, "%s:%d: %s\n", paths[0], error.line, error.text);
+		return 1;
+	}
+
+	rack::engineSetSampleRate(rate);
+
+	Graph graph;
+	graph.dataModule = dataModule;
+
+	if (data && !(graph.data = json_loads(data, 0, &error)))
+	{
+		std::fprintf(stderr, "-j: %s\n", error.text);
+		return 1;
+	}
+
+	graph.read(rootJ);
+	json_decref(rootJ);
+	json_decref(graph.data);
+
+	if (taps.empty()) taps = graph.taps;
+
+	std::vector<rack::Output *> outputs;
+	for (const Graph::Tap &tap : taps)
+	{
+		outputs.push_back(graph.output(tap));
+		if (outputs.back()) outputs.back()->active = true;
+	}
+
+	if (outputs.empty())
+	{
+		std::fprintf(stderr, "nothing to render, wire an AudioInterface or give -o\n");
+		return 1;
+	}
+
+	for (auto &module : graph.modules)
+	{
+		if (module) module->onSampleRateChange();
+	}
+
+	if (trace)
+	{
+		// Waits out the tracer's clock calibration so the render is traced from its first step
+		Tracer &tracer = Tracer::instance();
+		if (!tracer.start(trace))
+		{
+			std::fprintf(stderr, "cannot write trace %s\n", trace);
+			return 1;
+		}
+		while (tracer.running && !Tracer::tracing()) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	static const std::size_t CHUNK = 4096;
+
+	std::unique_ptr<Writer>  writer (paths.size() > 1 ? new Writer (paths[1],  outputs.size(), rate) : nullptr);
+	std::unique_ptr<Compare> compare(reference        ? new Compare(reference, outputs.size(), lag)  : nullptr);
+	std::vector<float> buffer(CHUNK * outputs.size());
+	std::size_t frames = static_cast<std::size_t>(seconds * rate);
+
+	double ns = nanoseconds([&]
+	{
+		for (std::size_t done=0; done<frames; )
+		{
+			std::size_t count = std::min(CHUNK, frames - done);
+
+			for (std::size_t f=0; f<count; ++f)
+			{
+				graph.step();
+
+				for (std::size_t c=0; c<outputs.size(); ++c)
+				{
+					buffer[f * outputs.size() + c] = outputs[c] ? outputs[c]->value / 10.0f : 0.0f;
+				}
+			}
+
+			if (writer ) writer ->write(buffer.data(), count);
+			if (compare) compare->add  (buffer.data(), count);
+			done += count;
+		}
+	});
+
+	std::fprintf(stderr, "%zu frames of %zu channels in %.3f s, %.1fx real time\n",
+		frames, outputs.size(), ns * 1e-9, seconds / (ns * 1e-9));
+
+	Tracer::instance().stop();
+
+	if (compare && !compare->report(dB)) return 2;
+
+	return 0;
+}
@@ -0,0 +1,338 @@
+//============================================================================================================
+//! \brief Worst-case soak, modules driven by adversarial input with every step() timed on its own.
+//!
+//! Build and run with "make soak", or run build/soak directly:
+//!
+//!   build/soak [-s seconds] [-r rate] [-x factor] [-q limit] [scenario ...]
+//!
+//! The bench reports the mean, which hides the steps that cost many times more: sync crossings, trigger
+//! resets, block boundaries.  Here each scenario sets its module's knobs to the costly end and drives the
+//! inputs that reach those paths at audio rate, then runs 'seconds' of audio (default 10) at 'rate'
+//! (default 44100) after a tenth of a second to warm up.  Per step it reports the median, p99, p99.9 and
+//! maximum, in the unit of StepProfile, and counts as outliers the steps over 'factor' (default 10) times
+//! the median, with the times of the slowest to line them up with the input.  Percentiles are exact, from
+//! every step kept.  Without names every scenario is run.
+//!
+//! Scenarios with a burst drive their inputs for that long, then hold every input at zero for the rest of
+//! the run, as decaying state is where subnormal floats come from.  Each second of that silence must stay
+//! at the median step of the burst, within 'limit' (default 2) times it, or the scenario fails and the
+//! exit status is 2.  For minutes of silence give the seconds, e.g. "build/soak -s 180 adsr-silence".
+//!
+//! The VCO scenarios run at a control rate of 16 frames, where only the pitch follows FM every frame, and
+//! again with the state of a patch saved with "Audio-rate modulation" ticked, so every control is taken
+//! every frame.
+//!
+//! Ports and knobs are given by index, the enums being private to each module's source, with the names
+//! in comments.  Inputs not listed are left unpatched.
+
+#include "Headless.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+
+using namespace GTX::Headless;
+
+
+//============================================================================================================
+//! \brief One input waveform, repeated on a port of every voice of a bank.
+
+struct Drive
+{
+	enum Wave { SINE, SQUARE, SAW, DC };
+
+	std::size_t port;
+	Wave  wave;
+	float hz;
+	float volts;
+
+	//! \brief The value at 'time', slightly detuned per voice so voices cross at different samples.
+	float at(double time, std::size_t voice) const
+	{
+		double phase = time * hz * (1.0 + 0.0137 * voice);
+		phase -= std::floor(phase);
+
+		switch (wave)
+		{
+			case SINE   : return volts * static_cast<float>(std::sin(GTX__2PI * phase));
+			case SQUARE : return phase < 0.5 ? volts : 0.0f;
+			case SAW    : return volts * static_cast<float>(2.0 * phase - 1.0);
+			case DC     : break;
+		}
+
+		return volts;
+	}
+};
+
+struct Scenario
+{
+	const char *name;
+	const char *slug;
+	std::size_t stride;  // Inputs per voice, zero for a module with one set
+	std::vector<std::pair<std::size_t, float>> params;
+	std::vector<Drive> drives;
+	double burst;      // Seconds driven before every input falls silent, zero to drive throughout
+	const char *json;  // Module state loaded as from a patch, null for a new module
+};
+
+
+//============================================================================================================
+//! \brief The paths known to cost unevenly.
+
+static const std::vector<Scenario> &scenarios()
+{
+	static const std::vector<Scenario> all =
+	{
+		// VCO: MODE 0, SYNC 1, FREQ 2, FM 4 / PITCH 0, FM 1, SYNC 2, PW 3
+		{"vco-hard-sync", "VCO-F1", 4, {{0, 1.0f}, {1, 1.0f}, {2, 54.0f}, {4, 1.0f}},
+			{{0, Drive::SAW, 3.1f, 2.0f}, {1, Drive::SINE, 3311.0f, 10.0f}, {2, Drive::SQUARE, 1907.0f, 10.0f}, {3, Drive::SINE, 251.0f, 5.0f}},
+			0.0, "{\"control_rate\": 16}"},
+		{"vco-soft-sync", "VCO-F1", 4, {{0, 1.0f}, {1, 0.0f}, {2, 54.0f}, {4, 1.0f}},
+			{{0, Drive::SAW, 3.1f, 2.0f}, {1, Drive::SINE, 3311.0f, 10.0f}, {2, Drive::SQUARE, 1907.0f, 10.0f}, {3, Drive::SINE, 251.0f, 5.0f}},
+			0.0, "{\"control_rate\": 16}"},
+		{"vco-audio-rate", "VCO-F1", 4, {{0, 1.0f}, {1, 1.0f}, {2, 54.0f}, {4, 1.0f}},
+			{{0, Drive::SAW, 3.1f, 2.0f}, {1, Drive::SINE, 3311.0f, 10.0f}, {2, Drive::SQUARE, 1907.0f, 10.0f}, {3, Drive::SINE, 251.0f, 5.0f}},
+			0.0, "{\"audio_rate\": true}"},
+
+		// VCO2: MODE 0, SYNC 1, FREQ 2, FM 4 / FM 0, SYNC 1, WAVE 2
+		{"vco2-hard-sync", "VCO-F2", 3, {{0, 1.0f}, {1, 1.0f}, {2, 54.0f}, {4, 1.0f}},
+			{{0, Drive::SINE, 3311.0f, 10.0f}, {1, Drive::SQUARE, 1907.0f, 10.0f}, {2, Drive::SAW, 97.0f, 5.0f}},
+			0.0, "{\"control_rate\": 16}"},
+		{"vco2-soft-sync", "VCO-F2", 3, {{0, 1.0f}, {1, 0.0f}, {2, 54.0f}, {4, 1.0f}},
+			{{0, Drive::SINE, 3311.0f, 10.0f}, {1, Drive::SQUARE, 1907.0f, 10.0f}, {2, Drive::SAW, 97.0f, 5.0f}},
+			0.0, "{\"control_rate\": 16}"},
+		{"vco2-audio-rate", "VCO-F2", 3, {{0, 1.0f}, {1, 1.0f}, {2, 54.0f}, {4, 1.0f}},
+			{{0, Drive::SINE, 3311.0f, 10.0f}, {1, Drive::SQUARE, 1907.0f, 10.0f}, {2, Drive::SAW, 97.0f, 5.0f}},
+			0.0, "{\"audio_rate\": true}"},
+
+		// VCF: FREQ 0, RES 2, FREQ_CV 3, DRIVE 4 / FREQ 0, RES 1, DRIVE 2, IN 3
+		{"vcf-max-res", "VCF-F1", 4, {{0, 1.0f}, {2, 1.0f}, {3, 1.0f}, {4, 1.0f}},
+			{{0, Drive::SINE, 1103.0f, 5.0f}, {1, Drive::DC, 0.0f, 10.0f}, {2, Drive::DC, 0.0f, 10.0f}, {3, Drive::SQUARE, 220.0f, 10.0f}}},
+
+		// ADSR: every time zero / GATE 4, TRIG 5, then a pair per voice
+		{"adsr-retrigger", "ADSR-F1", 2, {},
+			{{4, Drive::SQUARE, 2213.0f, 10.0f}, {5, Drive::SQUARE, 3517.0f, 10.0f}}},
+
+		// Seq: EXT_CLOCK 1, RESET 2
+		{"seq1-audio-clock", "Seq-G1-alpha1", 0, {},
+			{{1, Drive::SQUARE, 11025.0f, 10.0f}, {2, Drive::SQUARE, 1301.0f, 10.0f}}},
+		{"seq2-audio-clock", "Seq-G2-alpha1", 0, {},
+			{{1, Drive::SQUARE, 11025.0f, 10.0f}, {2, Drive::SQUARE, 1301.0f, 10.0f}}},
+
+		// Scope: TIME 2 at its shortest, EXTERNAL 4 off / X 0, TRIG 1
+		{"scope-fastest", "Scope-G1", 2, {{2, -16.0f}, {4, 1.0f}},
+			{{0, Drive::SINE, 4409.0f, 10.0f}, {1, Drive::SQUARE, 2711.0f, 10.0f}}},
+
+		// Burst then silence, envelopes and filters decaying towards zero
+		// ADSR: ATTACK 0, DECAY 1, SUSTAIN 2, RELEASE 3 / GATE 4, TRIG 5, then a pair per voice
+		{"adsr-silence", "ADSR-F1-16", 2, {{0, 0.0f}, {1, 0.3f}, {2, 0.5f}, {3, 0.3f}},
+			{{4, Drive::SQUARE, 7.0f, 10.0f}}, 2.0},
+		// VCF: FREQ 0, RES 2, DRIVE 4 / FREQ 0, RES 1, DRIVE 2, IN 3
+		{"vcf-silence", "VCF-F1-16", 4, {{0, 0.3f}, {2, 0.7f}, {4, 0.5f}},
+			{{3, Drive::SAW, 110.0f, 10.0f}}, 2.0},
+	};
+
+	return all;
+}
+
+
+//============================================================================================================
+//! \brief Every step's cost, kept to report exact percentiles and where the slowest fell.
+
+struct Soak
+{
+	std::vector<std::uint64_t> ticks;
+
+	void run(const Scenario &scenario, float rate, std::size_t warm, std::size_t frames)
+	{
+		std::unique_ptr<rack::Module> module(Rig::create(scenario.slug, rate));
+		if (scenario.json) Rig::load(*module, scenario.json);
+
+		for (const auto &param : scenario.params) module->params[param.first].value = param.second;
+		for (rack::Output &out : module->outputs) out.active = true;
+
+		struct Port { rack::Input *input; const Drive *drive; std::size_t voice; };
+		std::vector<Port> ports;
+
+		for (const Drive &drive : scenario.drives)
+		{
+			std::size_t voice = 0;
+
+			for (std::size_t i=drive.port; i<module->inputs.size(); i+=scenario.stride, ++voice)
+			{
+				module->inputs[i].active = true;
+				ports.push_back({&module->inputs[i], &drive, voice});
+
+				if (!scenario.stride) break;
+			}
+		}
+
+		module->onSampleRateChange();
+		ticks.assign(frames, 0);
+
+	#if defined(__SSE__)
+		// Start without FTZ and DAZ, as a host may, rather than with the mode the fast-math startup code set
+		_mm_setcsr(_mm_getcsr() & ~0x8040u);
+	#endif
+
+		for (std::size_t f=0; f<warm+frames; ++f)
+		{
+			double time = f / static_cast<double>(rate);
+
+			bool silent = scenario.burst > 0.0 && time >= scenario.burst;
+
+			for (const Port &port : ports) port.input->value = silent ? 0.0f : port.drive->at(time, port.voice);
+
+			std::uint64_t start = StepProfile::now();
+			module->step();
+			std::uint64_t cost  = StepProfile::now() - start;
+
+			if (f >= warm) ticks[f - warm] = cost;
+		}
+	}
+
+	//! \brief The step at 'q' of the way through the sorted costs.
+	static std::uint64_t percentile(const std::vector<std::uint64_t> &sorted, double q)
+	{
+		return sorted[std::min(sorted.size() - 1, static_cast<std::size_t>(q * sorted.size()))];
+	}
+
+	void report(const char *name, float rate, double factor) const
+	{
+		std::vector<std::uint64_t> sorted(ticks);
+		std::sort(sorted.begin(), sorted.end());
+
+		std::uint64_t median  = percentile(sorted, 0.5);
+		std::uint64_t limit   = static_cast<std::uint64_t>(factor * median);
+		std::size_t outliers  = sorted.end() - std::upper_bound(sorted.begin(), sorted.end(), limit);
+
+		std::printf("%-18s %8llu %8llu %8llu %10llu %8zu\n", name,
+			(unsigned long long) median,
+			(unsigned long long) percentile(sorted, 0.99),
+			(unsigned long long) percentile(sorted, 0.999),
+			(unsigned long long) sorted.back(),
+			outliers);
+
+		if (!outliers) return;
+
+		// The three slowest, in order of cost
+		std::vector<std::size_t> order(ticks.size());
+		for (std::size_t f=0; f<order.size(); ++f) order[f] = f;
+		std::partial_sort(order.begin(), order.begin() + std::min<std::size_t>(3, order.size()), order.end(),
+			[&](std::size_t a, std::size_t b) { return ticks[a] > ticks[b]; });
+
+		std::printf("%18s", "slowest at");
+		for (std::size_t k=0; k<3 && k<outliers; ++k)
+		{
+			std::printf("  %.4f s (%llu)", order[k] / static_cast<double>(rate), (unsigned long long) ticks[order[k]]);
+		}
+		std::printf("\n");
+	}
+
+	//! \brief Whether every second after 'burst' kept within 'limit' times the median step of the burst.
+	bool silence(double burst, std::size_t warm, float rate, double limit) const
+	{
+		std::size_t second = static_cast<std::size_t>(rate);
+		std::size_t quiet  = std::max(warm, static_cast<std::size_t>(burst * rate)) - warm;
+
+		if (quiet < second || quiet + second > ticks.size())
+		{
+			std::printf("%18s  burst or silence shorter than a second\n", "silence");
+			return false;
+		}
+
+		auto median = [&](std::size_t begin, std::size_t end)
+		{
+			std::vector<std::uint64_t> part(ticks.begin() + begin, ticks.begin() + end);
+			std::nth_element(part.begin(), part.begin() + part.size() / 2, part.end());
+			return part[part.size() / 2];
+		};
+
+		std::uint64_t steady = median(0, quiet);
+		std::uint64_t worst  = 0;
+		std::size_t   at     = quiet;
+
+		for (std::size_t begin=quiet; begin+second<=ticks.size(); begin+=second)
+		{
+			std::uint64_t m = median(begin, begin + second);
+			if (m > worst) { worst = m; at = begin; }
+		}
+
+		double ratio = worst / static_cast<double>(std::max<std::uint64_t>(steady, 1));
+		bool   ok    = ratio <= limit;
+
+		std::printf("%18s  burst median %llu, worst second of silence %llu at %.0f s (%.2fx)%s\n", "silence",
+			(unsigned long long) steady, (unsigned long long) worst, (at + warm) / static_cast<double>(rate), ratio,
+			ok ? "" : "  FAIL");
+
+		return ok;
+	}
+};
+
+
+//============================================================================================================
+
+int main(int argc, char *argv[])
+{
+	double seconds = 10.0;
+	float  rate    = 44100.0f;
+	double factor  = 10.0;
+	double limit   = 2.0;
+	std::vector<const Scenario *> chosen;
+	bool usage = false;
+
+	for (int i=1; i<argc; ++i)
+	{
+		if      (!std::strcmp(argv[i], "-s") && i+1 < argc) seconds = std::atof(argv[++i]);
+		else if (!std::strcmp(argv[i], "-r") && i+1 < argc) rate    = std::atof(argv[++i]);
+		else if (!std::strcmp(argv[i], "-x") && i+1 < argc) factor  = std::atof(argv[++i]);
+		else if (!std::strcmp(argv[i], "-q") && i+1 < argc) limit   = std::atof(argv[++i]);
+		else if (argv[i][0] != '-')
+		{
+			const Scenario *found = nullptr;
+			for (const Scenario &s : scenarios()) if (!std::strcmp(s.name, argv[i])) found = &s;
+
+			usage = usage || !found;
+			chosen.push_back(found);
+		}
+		else usage = true;
+	}
+
+	if (usage)
+	{
+		std::fprintf(stderr, "usage: %s [-s seconds] [-r rate] [-x factor] [-q limit] [scenario ...]\nscenarios:", argv[0]);
+		for (const Scenario &s : scenarios()) std::fprintf(stderr, " %s", s.name);
+		std::fprintf(stderr, "\n");
+		return 1;
+	}
+
+	if (chosen.empty())
+	{
+		for (const Scenario &s : scenarios()) chosen.push_back(&s);
+	}
+
+	std::size_t frames = static_cast<std::size_t>(seconds * rate);
+
+	std::printf("%s per step, outliers over %gx the median\n", StepProfile::unit(), factor);
+	std::printf("%-18s %8s %8s %8s %10s %8s\n", "scenario", "median", "p99", "p99.9", "max", "outliers");
+
+	std::size_t warm     = static_cast<std::size_t>(rate / 10);
+	std::size_t failures = 0;
+
+	for (const Scenario *scenario : chosen)
+	{
+		Soak soak;
+		soak.run(*scenario, rate, warm, frames);
+		soak.report(scenario->name, rate, factor);
+
+		if (scenario->burst > 0.0 && !soak.silence(scenario->burst, warm, rate, limit)) ++failures;
+	}
+
+	if (failures)
+	{
+		std::printf("%zu scenarios slowed down in silence\n", failures);
+		return 2;
+	}
+
+	return 0;
+}
@@ -0,0 +1,91 @@
+#ifndef GTX__SHIM_DSP_DECIMATOR_HPP
+#define GTX__SHIM_DSP_DECIMATOR_HPP
+
+
+#include <cmath>
+#include <cstring>
+
+
+//============================================================================================================
+//! \brief Rack 0.6 dsp/decimator.hpp, with the kernel helpers from dsp/fir.hpp and dsp/window.hpp.
+
+namespace rack {
+
+
+inline float sinc(float x)
+{
+	if (x == 0.f) return 1.f;
+	x *= M_PI;
+	return std::sin(x) / x;
+}
+
+//! \brief Windowless sinc lowpass, 'cutoff' as a fraction of the sample rate.
+inline void boxcarLowpassIR(float *out, int len, float cutoff = 0.5f)
+{
+	for (int i=0; i<len; ++i)
+	{
+		float t = i - (len - 1) / 2.f;
+		out[i] = 2 * cutoff * sinc(2 * cutoff * t);
+	}
+}
+
+inline void blackmanHarrisWindow(float *x, int n)
+{
+	const float a0 = 0.35875f;
+	const float a1 = 0.48829f;
+	const float a2 = 0.14128f;
+	const float a3 = 0.01168f;
+
+	for (int i=0; i<n; ++i)
+	{
+		x[i] *= a0
+			- a1 * std::cos(2 * M_PI * i / (n - 1))
+			+ a2 * std::cos(4 * M_PI * i / (n - 1))
+			- a3 * std::cos(6 * M_PI * i / (n - 1));
+	}
+}
+
+
+//! \brief Takes OVERSAMPLE samples at a time and returns one, through a QUALITY * OVERSAMPLE tap FIR.
+template <int OVERSAMPLE, int QUALITY>
+struct Decimator
+{
+	float inBuffer[OVERSAMPLE*QUALITY];
+	float kernel[OVERSAMPLE*QUALITY];
+	int inIndex;
+
+	Decimator(float cutoff = 0.9f)
+	{
+		boxcarLowpassIR(kernel, OVERSAMPLE*QUALITY, cutoff * 0.5f / OVERSAMPLE);
+		blackmanHarrisWindow(kernel, OVERSAMPLE*QUALITY);
+		reset();
+	}
+
+	void reset()
+	{
+		inIndex = 0;
+		std::memset(inBuffer, 0, sizeof(inBuffer));
+	}
+
+	float process(float *in)
+	{
+		std::memcpy(&inBuffer[inIndex], in, OVERSAMPLE*sizeof(float));
+		inIndex += OVERSAMPLE;
+		inIndex %= OVERSAMPLE*QUALITY;
+
+		float out = 0.f;
+		for (int i=0; i<OVERSAMPLE*QUALITY; ++i)
+		{
+			int index = inIndex - 1 - i;
+			index = (index + OVERSAMPLE*QUALITY) % (OVERSAMPLE*QUALITY);
+			out += kernel[i] * inBuffer[index];
+		}
+		return out;
+	}
+};
+
+
+} // rack
+
+
+#endif
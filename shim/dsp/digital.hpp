@@ -0,0 +1,92 @@
+#ifndef GTX__SHIM_DSP_DIGITAL_HPP
+#define GTX__SHIM_DSP_DIGITAL_HPP
+
+
+//============================================================================================================
+//! \brief Rack 0.6 dsp/digital.hpp, the triggers and pulses.
+
+namespace rack {
+
+
+//! \brief Turns HIGH when the input reaches 1 and LOW when it falls to 0.
+struct SchmittTrigger
+{
+	enum State
+	{
+		UNKNOWN,  // Stable until the first crossing
+		LOW,
+		HIGH
+	};
+
+	State state = UNKNOWN;
+
+	void reset()
+	{
+		state = UNKNOWN;
+	}
+
+	//! \brief True on the step the input rises from LOW to HIGH.
+	bool process(float in)
+	{
+		switch (state)
+		{
+			case LOW :
+				if (in >= 1.f)
+				{
+					state = HIGH;
+					return true;
+				}
+				break;
+			case HIGH :
+				if (in <= 0.f) state = LOW;
+				break;
+			default :
+				if      (in >= 1.f) state = HIGH;
+				else if (in <= 0.f) state = LOW;
+				break;
+		}
+
+		return false;
+	}
+
+	bool isHigh()
+	{
+		return state == HIGH;
+	}
+};
+
+
+//! \brief High for a while after trigger().
+struct PulseGenerator
+{
+	float time = 0.f;
+	float triggerDuration = 0.f;
+
+	void reset()
+	{
+		time = triggerDuration = 0.f;
+	}
+
+	//! \brief Advances by 'deltaTime' seconds, true while the pulse lasts.
+	bool process(float deltaTime)
+	{
+		time += deltaTime;
+		return time < triggerDuration;
+	}
+
+	//! \brief Starts a pulse, unless the current one would outlast it.
+	void trigger(float triggerDuration)
+	{
+		if (time + triggerDuration >= this->triggerDuration)
+		{
+			time = 0.f;
+			this->triggerDuration = triggerDuration;
+		}
+	}
+};
+
+
+} // rack
+
+
+#endif
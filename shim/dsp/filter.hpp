@@ -0,0 +1,45 @@
+#ifndef GTX__SHIM_DSP_FILTER_HPP
+#define GTX__SHIM_DSP_FILTER_HPP
+
+
+//============================================================================================================
+//! \brief Rack 0.6 dsp/filter.hpp, the one-pole filter.
+
+namespace rack {
+
+
+struct RCFilter
+{
+	float c = 0.f;
+	float xstate[1] = {};
+	float ystate[1] = {};
+
+	//! \brief 'r' is the cutoff over the sample rate.
+	void setCutoff(float r)
+	{
+		c = 2.f / r;
+	}
+
+	void process(float x)
+	{
+		float y = (x + xstate[0] - ystate[0] * (1 - c)) / (1 + c);
+		xstate[0] = x;
+		ystate[0] = y;
+	}
+
+	float lowpass()
+	{
+		return ystate[0];
+	}
+
+	float highpass()
+	{
+		return xstate[0] - ystate[0];
+	}
+};
+
+
+} // rack
+
+
+#endif
@@ -0,0 +1,58 @@
+#include "rack.hpp"
+
+#include <random>
+
+
+namespace rack {
+
+
+//============================================================================================================
+//! \name Engine.
+
+static float sampleRate = 44100.f;
+static float sampleTime = 1.f / 44100.f;
+
+float engineGetSampleRate()
+{
+	return sampleRate;
+}
+
+float engineGetSampleTime()
+{
+	return sampleTime;
+}
+
+void engineSetSampleRate(float newSampleRate)
+{
+	sampleRate = newSampleRate;
+	sampleTime = 1.f / newSampleRate;
+}
+
+
+//============================================================================================================
+//! \name Random numbers, a fixed seed so tools repeat unless they reseed.
+
+static std::mt19937_64 generator;
+
+void randomSeed(std::uint64_t seed)
+{
+	generator.seed(seed);
+}
+
+std::uint32_t randomu32()
+{
+	return static_cast<std::uint32_t>(generator() >> 32);
+}
+
+float randomUniform()
+{
+	return (randomu32() >> 8) * (1.f / 16777216.f);
+}
+
+float randomNormal()
+{
+	return std::normal_distribution<float>(0.f, 1.f)(generator);
+}
+
+
+} // rack
@@ -0,0 +1,271 @@
+#ifndef GTX__SHIM_RACK_HPP
+#define GTX__SHIM_RACK_HPP
+
+
+//============================================================================================================
+//! \brief The part of the Rack 0.6 API the module DSP uses, so it builds on plain Linux ("make dsp").
+//!
+//! Found ahead of Rack's own header by -Ishim, together with GTX__WIDGETS=0 which leaves the widgets out
+//! of the module sources.  Names and behaviour follow Rack 0.6 so the same code runs in both, the only
+//! additions are engineSetSampleRate() doing no more than storing the rate, and randomSeed() for
+//! repeatable runs.  JSON is the system's jansson, as in Rack.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <vector>
+#include <jansson.h>
+
+
+#define TOSTRING_(x) #x
+#define TOSTRING(x) TOSTRING_(x)
+
+
+namespace rack {
+
+
+//============================================================================================================
+//! \name Maths, as util/math.hpp.
+
+inline int   clamp(int   x, int   a, int   b) { return std::min(std::max(x, a), b); }
+inline float clamp(float x, float a, float b) { return std::fmin(std::fmax(x, a), b); }
+
+inline float rescale(float x, float xMin, float xMax, float yMin, float yMax)
+{
+	return yMin + (x - xMin) / (xMax - xMin) * (yMax - yMin);
+}
+
+inline float crossfade(float a, float b, float frac)
+{
+	return a + frac * (b - a);
+}
+
+inline float quadraticBipolar(float x)
+{
+	float x2 = x * x;
+	return (x >= 0.f) ? x2 : -x2;
+}
+
+inline float interpolateLinear(const float *p, float x)
+{
+	int xi = x;
+	float xf = x - xi;
+	return crossfade(p[xi], p[xi+1], xf);
+}
+
+
+//============================================================================================================
+//! \name Engine and random numbers, defined in shim/rack.cpp.
+
+float engineGetSampleRate();
+float engineGetSampleTime();
+void  engineSetSampleRate(float sampleRate);
+
+//! \brief Restarts the global generator, which starts from a fixed seed rather than the clock.
+void     randomSeed(std::uint64_t seed);
+std::uint32_t randomu32();
+float    randomUniform();
+float    randomNormal();
+
+
+//============================================================================================================
+//! \name Modules, as engine.hpp.
+
+struct Param
+{
+	float value = 0.0;
+};
+
+struct Light
+{
+	float value = 0.0;  // The square of the brightness
+
+	void setBrightness(float brightness)
+	{
+		value = (brightness > 0.f) ? brightness * brightness : 0.f;
+	}
+
+	//! \brief Falls slowly but rises at once, 'frames' is the number of samples between calls.
+	void setBrightnessSmooth(float brightness, float frames = 1.f)
+	{
+		float v = (brightness > 0.f) ? brightness * brightness : 0.f;
+		value = (v < value) ? value + (v - value) * engineGetSampleTime() * frames * 60.f : v;
+	}
+};
+
+struct Input
+{
+	float value = 0.0;
+	bool active = false;
+	Light plugLights[2];
+
+	float normalize(float normalVoltage)
+	{
+		return active ? value : normalVoltage;
+	}
+};
+
+struct Output
+{
+	float value = 0.0;
+	bool active = false;
+	Light plugLights[2];
+};
+
+struct Module
+{
+	std::vector<Param> params;
+	std::vector<Input> inputs;
+	std::vector<Output> outputs;
+	std::vector<Light> lights;
+	float cpuTime = 0.0;
+
+	Module() {}
+
+	Module(int numParams, int numInputs, int numOutputs, int numLights = 0)
+	{
+		params.resize(numParams);
+		inputs.resize(numInputs);
+		outputs.resize(numOutputs);
+		lights.resize(numLights);
+	}
+
+	virtual ~Module() {}
+
+	virtual void step() {}
+	virtual void onSampleRateChange() {}
+	virtual void onCreate() {}
+	virtual void onDelete() {}
+	virtual void onReset() {}
+	virtual void onRandomize() {}
+	virtual json_t *toJson() { return nullptr; }
+	virtual void fromJson(json_t *rootJ) {}
+	virtual void reset() {}
+	virtual void randomize() {}
+};
+
+
+//============================================================================================================
+//! \name Plugins and models, as plugin.hpp, less the widgets.
+
+enum ModelTag
+{
+	NO_TAG,
+	AMPLIFIER_TAG,
+	ATTENUATOR_TAG,
+	BLANK_TAG,
+	CHORUS_TAG,
+	CLOCK_MODULATOR_TAG,
+	CLOCK_TAG,
+	COMPRESSOR_TAG,
+	CONTROLLER_TAG,
+	DELAY_TAG,
+	DIGITAL_TAG,
+	DISTORTION_TAG,
+	DRUM_TAG,
+	DUAL_TAG,
+	DYNAMICS_TAG,
+	EFFECT_TAG,
+	ENVELOPE_FOLLOWER_TAG,
+	ENVELOPE_GENERATOR_TAG,
+	EQUALIZER_TAG,
+	EXTERNAL_TAG,
+	FILTER_TAG,
+	FUNCTION_GENERATOR_TAG,
+	GRANULAR_TAG,
+	LFO_TAG,
+	LIMITER_TAG,
+	LOGIC_TAG,
+	LOW_PASS_GATE_TAG,
+	MIDI_TAG,
+	MIXER_TAG,
+	MULTIPLE_TAG,
+	NOISE_TAG,
+	OSCILLATOR_TAG,
+	PANNING_TAG,
+	QUAD_TAG,
+	QUANTIZER_TAG,
+	RANDOM_TAG,
+	REVERB_TAG,
+	RING_MODULATOR_TAG,
+	SAMPLE_AND_HOLD_TAG,
+	SAMPLER_TAG,
+	SEQUENCER_TAG,
+	SLEW_LIMITER_TAG,
+	SWITCH_TAG,
+	SYNTH_VOICE_TAG,
+	TUNER_TAG,
+	UTILITY_TAG,
+	VISUAL_TAG,
+	VOCODER_TAG,
+	WAVESHAPER_TAG,
+	NUM_TAGS
+};
+
+struct Plugin;
+
+struct Model
+{
+	Plugin *plugin = nullptr;
+	std::string author;
+	std::string slug;
+	std::string name;
+	std::list<ModelTag> tags;
+
+	virtual ~Model() {}
+
+	virtual Module *createModule() { return nullptr; }
+
+	//! \brief The widget type is never made, so it may be only declared.
+	template <typename TModule, typename TModuleWidget, typename... Tags>
+	static Model *create(std::string author, std::string slug, std::string name, Tags... tags)
+	{
+		struct TModel : Model
+		{
+			Module *createModule() override
+			{
+				return new TModule();
+			}
+		};
+
+		Model *model = new TModel();
+		model->author = author;
+		model->slug = slug;
+		model->name = name;
+		model->tags = {tags...};
+		return model;
+	}
+};
+
+struct Plugin
+{
+	std::list<Model *> models;
+	std::string path;
+	std::string slug;
+	std::string version;
+
+	void addModel(Model *model)
+	{
+		model->plugin = this;
+		models.push_back(model);
+	}
+
+	//! \brief The model with the given slug, or null.
+	Model *getModel(const std::string &slug) const
+	{
+		for (Model *model : models)
+		{
+			if (model->slug == slug) return model;
+		}
+
+		return nullptr;
+	}
+};
+
+
+} // rack
+
+
+#endif
@@ -36,83 +36,44 @@ struct ADSR : MicroModule {
 		NUM_LIGHTS
 	};
 
-	bool decaying = false;
-	float env = 0.0f;
-	SchmittTrigger trigger;
-
 	ADSR() : MicroModule(NUM_PARAMS, NUM_INPUTS, NUM_OUTPUTS, NUM_LIGHTS) {}
-	void step();
 };
 
 
 //============================================================================================================
 
-void ADSR::step() {
-	float attack = clamp(params[ATTACK_INPUT].value + inputs[ATTACK_INPUT].value / 10.0f, 0.0f, 1.0f);
-	float decay = clamp(params[DECAY_PARAM].value + inputs[DECAY_INPUT].value / 10.0f, 0.0f, 1.0f);
-	float sustain = clamp(params[SUSTAIN_PARAM].value + inputs[SUSTAIN_INPUT].value / 10.0f, 0.0f, 1.0f);
-	float release = clamp(params[RELEASE_PARAM].value + inputs[RELEASE_PARAM].value / 10.0f, 0.0f, 1.0f);
-
-	// Gate and trigger
-	bool gated = inputs[GATE_INPUT].value >= 1.0f;
-	if (trigger.process(inputs[TRIG_INPUT].value))
-		decaying = false;
-
-	const float base = 20000.0f;
-	const float maxTime = 10.0f;
-	if (gated) {
-		if (decaying) {
-			// Decay
-			if (decay < 1e-4) {
-				env = sustain;
-			}
-			else {
-				env += powf(base, 1 - decay) / maxTime * (sustain - env) * engineGetSampleTime();
-			}
-		}
-		else {
-			// Attack
-			// Skip ahead if attack is all the way down (infinitely fast)
-			if (attack < 1e-4) {
-				env = 1.0f;
-			}
-			else {
-				env += powf(base, 1 - attack) / maxTime * (1.01f - env) * engineGetSampleTime();
-			}
-			if (env >= 1.0f) {
-				env = 1.0f;
-				decaying = true;
-			}
-		}
-	}
-	else {
-		// Release
-		if (release < 1e-4) {
-			env = 0.0f;
-		}
-		else {
-			env += powf(base, 1 - release) / maxTime * (0.0f - env) * engineGetSampleTime();
-		}
-		decaying = false;
-	}
+template <std::size_t N>
+struct GtxModule : Module, Voices<N>
+{
+	static constexpr std::size_t L = simd_lanes(N);
 
-	outputs[ENVELOPE_OUTPUT].value = 10.0 * env;
-	outputs[INVERTED_OUTPUT].value = 10.0 * (1.0 - env);
-}
+	std::array<ADSR, N> inst;
+	RouteTable<N, ADSR::NUM_INPUTS> routes;
+	VoiceMask<N, ADSR::NUM_INPUTS, ADSR::NUM_OUTPUTS> voices;
 
+	alignas(16) float env[L] = {};
+	bool decaying[L] = {};
+	SchmittTrigger trigger[N];
 
-//============================================================================================================
-
-struct GtxModule : Module
-{
-	std::array<ADSR, GTX__N> inst;
+	Block<N, ADSR::NUM_INPUTS, ADSR::NUM_OUTPUTS> block;
+	ControlRate rate;
+	Ramp<3> rates;  // Attack, decay and release
+	Memo<float, 1> attackToRate {1e-5f};
+	Memo<float, 1> decayToRate  {1e-5f};
+	Memo<float, 1> releaseToRate{1e-5f};
+	StepProfile profile{this};
 
 	GtxModule()
 	:
 		Module(ADSR::NUM_PARAMS,
-			(GTX__N+1) * (ADSR::NUM_INPUTS  - ADSR::OFF_INPUTS ) + ADSR::OFF_INPUTS,
-			(GTX__N  ) * (ADSR::NUM_OUTPUTS - ADSR::OFF_OUTPUTS) + ADSR::OFF_OUTPUTS)
-	{}
+			(N+1) * (ADSR::NUM_INPUTS  - ADSR::OFF_INPUTS ) + ADSR::OFF_INPUTS,
+			(N  ) * (ADSR::NUM_OUTPUTS - ADSR::OFF_OUTPUTS) + ADSR::OFF_OUTPUTS)
+	{
+		for (std::size_t i=0; i<N; ++i)
+		{
+			inst[i].bind(*this, i);
+		}
+	}
 
 	static constexpr std::size_t imap(std::size_t port, std::size_t bank)
 	{
@@ -125,17 +86,133 @@ struct GtxModule : Module
 		return                                     port + bank *  ADSR::NUM_OUTPUTS;
 	}
 
+	json_t *toJson() override
+	{
+		json_t *rootJ = json_object();
+
+		blockSizeToJson(rootJ, block);
+		controlRateToJson(rootJ, rate);
+
+		return rootJ;
+	}
+
+	void fromJson(json_t *rootJ) override
+	{
+		blockSizeFromJson(rootJ, block);
+		controlRateFromJson(rootJ, rate);
+	}
+
 	void step() override
 	{
-		for (std::size_t i=0; i<GTX__N; ++i)
+		StepTimer timer(profile);
+
+		if (routes.update(*this))
+		{
+			for (std::size_t i=0; i<N; ++i)
+			{
+				inst[i].route(routes, i);
+			}
+		}
+
+		voices.update(*this);
+
+		if (block.push(inst))
+		{
+			DenormalGuard guard;
+			process();
+		}
+
+		block.pull(inst);
+	}
+
+	//! \brief Runs the envelopes over every frame of the block.
+	void process()
+	{
+		const float dt = engineGetSampleTime();
+
+		if (!voices.lanes) return;
+
+		for (std::size_t f=0; f<block.size; ++f)
 		{
-			for (std::size_t p=0; p<ADSR::NUM_PARAMS;  ++p) inst[i].params[p]  = params[p];
-			for (std::size_t p=0; p<ADSR::NUM_INPUTS;  ++p) inst[i].inputs[p]  = inputs[imap(p, i)].active ? inputs[imap(p, i)] : inputs[imap(p, GTX__N)];
-			for (std::size_t p=0; p<ADSR::NUM_OUTPUTS; ++p) inst[i].outputs[p] = outputs[omap(p, i)];
+			// Shared inputs read the same in every lane
+			float attack = clamp(params[ADSR::ATTACK_PARAM].value + block.in[f][ADSR::ATTACK_INPUT][0] / 10.0f, 0.0f, 1.0f);
+			float decay = clamp(params[ADSR::DECAY_PARAM].value + block.in[f][ADSR::DECAY_INPUT][0] / 10.0f, 0.0f, 1.0f);
+			float sustain = clamp(params[ADSR::SUSTAIN_PARAM].value + block.in[f][ADSR::SUSTAIN_INPUT][0] / 10.0f, 0.0f, 1.0f);
+			float release = clamp(params[ADSR::RELEASE_PARAM].value + block.in[f][ADSR::RELEASE_INPUT][0] / 10.0f, 0.0f, 1.0f);
+
+			// The stages are shared by every voice so their rates only need working out once, at control rate
+			if (rate.due())
+			{
+				const float log2Base = std::log2(20000.0f);
+				const float maxTime = 10.0f;
+				const float target[3] = {
+					attackToRate ({attack},  [&]() { return fastmath::pow<fastmath::MEDIUM>(log2Base, 1 - attack)  / maxTime; }),
+					decayToRate  ({decay},   [&]() { return fastmath::pow<fastmath::MEDIUM>(log2Base, 1 - decay)   / maxTime; }),
+					releaseToRate({release}, [&]() { return fastmath::pow<fastmath::MEDIUM>(log2Base, 1 - release) / maxTime; })
+				};
+
+				rates.seek(target, rate.frames());
+			}
+
+			rates.step();
 
-			inst[i].step();
+			const float attackRate  = rates.value[0];
+			const float decayRate   = rates.value[1];
+			const float releaseRate = rates.value[2];
+
+			// Gate and trigger
+			const float *gate = block.in[f][ADSR::GATE_INPUT];
+
+			for (std::size_t i=0; i<N; ++i)
+			{
+				if (voices[i] && trigger[i].process(block.in[f][ADSR::TRIG_INPUT][i]))
+					decaying[i] = false;
+			}
 
-			for (std::size_t p=0; p<ADSR::NUM_OUTPUTS; ++p) outputs[omap(p, i)].value = inst[i].outputs[p].value;
+			for (std::size_t k=0; k<voices.lanes; ++k)
+			{
+				if (gate[k] >= 1.0f) {
+					if (decaying[k]) {
+						// Decay
+						if (decay < 1e-4) {
+							env[k] = sustain;
+						}
+						else {
+							env[k] = flush(env[k] + decayRate * (sustain - env[k]) * dt);
+						}
+					}
+					else {
+						// Attack
+						// Skip ahead if attack is all the way down (infinitely fast)
+						if (attack < 1e-4) {
+							env[k] = 1.0f;
+						}
+						else {
+							env[k] += attackRate * (1.01f - env[k]) * dt;
+						}
+						if (env[k] >= 1.0f) {
+							env[k] = 1.0f;
+							decaying[k] = true;
+						}
+					}
+				}
+				else {
+					// Release
+					if (release < 1e-4) {
+						env[k] = 0.0f;
+					}
+					else {
+						env[k] = flush(env[k] + releaseRate * (0.0f - env[k]) * dt);
+					}
+					decaying[k] = false;
+				}
+			}
+
+			for (std::size_t k=0; k<voices.lanes; ++k)
+			{
+				block.out[f][ADSR::ENVELOPE_OUTPUT][k] = 10.0 * env[k];
+				block.out[f][ADSR::INVERTED_OUTPUT][k] = 10.0 * (1.0 - env[k]);
+			}
 		}
 	}
 };
@@ -143,9 +220,11 @@ struct GtxModule : Module
 
 //============================================================================================================
 
+#if GTX__WIDGETS
+template <std::size_t N>
 struct GtxWidget : ModuleWidget
 {
-	GtxWidget(GtxModule *module) : ModuleWidget(module)
+	GtxWidget(GtxModule<N> *module) : ModuleWidget(module)
 	{
 		GTX__WIDGET();
 		box.size = Vec(12*15, 380);
@@ -179,22 +258,34 @@ struct GtxWidget : ModuleWidget
 		addInput(createInputGTX<PortInMed>(Vec(fx(0-0.28), fy(+0.28)), module, ADSR::SUSTAIN_INPUT));
 		addInput(createInputGTX<PortInMed>(Vec(fx(1-0.28), fy(+0.28)), module, ADSR::RELEASE_INPUT));
 
-		for (std::size_t i=0; i<GTX__N; ++i)
+		for (std::size_t i=0; i<N; ++i)
 		{
-			addInput(createInputGTX<PortInMed>(Vec(px(0, i), py(1, i)), module, GtxModule::imap(ADSR::GATE_INPUT, i)));
-			addInput(createInputGTX<PortInMed>(Vec(px(0, i), py(2, i)), module, GtxModule::imap(ADSR::TRIG_INPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(0, i, N), py(1, i, N)), module, GtxModule<N>::imap(ADSR::GATE_INPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(0, i, N), py(2, i, N)), module, GtxModule<N>::imap(ADSR::TRIG_INPUT, i)));
 
-			addOutput(createOutputGTX<PortOutMed>(Vec(px(1, i), py(1, i)), module, GtxModule::omap(ADSR::ENVELOPE_OUTPUT, i)));
-			addOutput(createOutputGTX<PortOutMed>(Vec(px(1, i), py(2, i)), module, GtxModule::omap(ADSR::INVERTED_OUTPUT, i)));
+			addOutput(createOutputGTX<PortOutVoice<N>>(Vec(px(1, i, N), py(1, i, N)), module, GtxModule<N>::omap(ADSR::ENVELOPE_OUTPUT, i)));
+			addOutput(createOutputGTX<PortOutVoice<N>>(Vec(px(1, i, N), py(2, i, N)), module, GtxModule<N>::omap(ADSR::INVERTED_OUTPUT, i)));
 		}
 
-		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(1)), module, GtxModule::imap(ADSR::GATE_INPUT, GTX__N)));
-		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(2)), module, GtxModule::imap(ADSR::TRIG_INPUT, GTX__N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(1)), module, GtxModule<N>::imap(ADSR::GATE_INPUT, N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(2)), module, GtxModule<N>::imap(ADSR::TRIG_INPUT, N)));
+	}
+
+	void appendContextMenu(Menu *menu) override
+	{
+		appendBlockSizeMenu(menu, static_cast<GtxModule<N> *>(module)->block);
+		appendControlRateMenu(menu, static_cast<GtxModule<N> *>(module)->rate);
+		appendProfileMenu(menu, static_cast<GtxModule<N> *>(module)->profile);
 	}
 };
+#else
+template <std::size_t N> struct GtxWidget;
+#endif
 
 
-Model *model = Model::create<GtxModule, GtxWidget>("Gratrix", "ADSR-F1", "ADSR-F1", ENVELOPE_GENERATOR_TAG);
+Model *model    = Model::create<GtxModule<GTX__N>, GtxWidget<GTX__N>>("Gratrix", "ADSR-F1",    "ADSR-F1",    ENVELOPE_GENERATOR_TAG);
+Model *model_8  = Model::create<GtxModule<8>,      GtxWidget<8>>     ("Gratrix", "ADSR-F1-8",  "ADSR-F1-8",  ENVELOPE_GENERATOR_TAG);
+Model *model_16 = Model::create<GtxModule<16>,     GtxWidget<16>>    ("Gratrix", "ADSR-F1-16", "ADSR-F1-16", ENVELOPE_GENERATOR_TAG);
 
 
 } // ADSR_F1
@@ -17,7 +17,8 @@ namespace Binary_G1 {
 //============================================================================================================
 //! \brief The module.
 
-struct GtxModule : Module
+template <std::size_t N>
+struct GtxModule : Module, Voices<N>
 {
 	enum ParamIds {
 		INVERT_A_PARAM,
@@ -54,11 +55,14 @@ struct GtxModule : Module
 		NUM_LIGHTS
 	};
 
+	RouteTable<N, NUM_INPUTS> routes;
+	StepProfile profile{this};
+
 	GtxModule()
 	:
 		Module(NUM_PARAMS,
-		(GTX__N+1) * (NUM_INPUTS  - OFF_INPUTS ) + OFF_INPUTS,
-		(GTX__N  ) * (NUM_OUTPUTS - OFF_OUTPUTS) + OFF_OUTPUTS,
+		(N+1) * (NUM_INPUTS  - OFF_INPUTS ) + OFF_INPUTS,
+		(N  ) * (NUM_OUTPUTS - OFF_OUTPUTS) + OFF_OUTPUTS,
 		NUM_LIGHTS)
 	{
 	}
@@ -75,6 +79,10 @@ struct GtxModule : Module
 
 	void step() override
 	{
+		StepTimer timer(profile);
+
+		routes.update(*this, OFF_INPUTS, NUM_INPUTS);
+
 		float leds[NUM_LIGHTS] = {};
 
 		int fn1 = FUNCTION_0_AB_1_LIGHT + static_cast<int>(params[FUNCTION_AB_1_PARAM].value + 0.5f);
@@ -83,10 +91,10 @@ struct GtxModule : Module
 		if (fn1 >= FUNCTION_0_AB_1_LIGHT && fn1 <= FUNCTION_4_AB_1_LIGHT) leds[fn1] = 1.0;
 		if (fn2 >= FUNCTION_0_AB_2_LIGHT && fn2 <= FUNCTION_4_AB_2_LIGHT) leds[fn2] = 1.0;
 
-		for (std::size_t i=0; i<GTX__N; ++i)
+		for (std::size_t i=0; i<N; ++i)
 		{
-			bool inA = (inputs[imap(IN_A_INPUT, i)].active ? inputs[imap(IN_A_INPUT, i)].value : inputs[imap(IN_A_INPUT, GTX__N)].value) >= 1.0f;
-			bool inB = (inputs[imap(IN_B_INPUT, i)].active ? inputs[imap(IN_B_INPUT, i)].value : inputs[imap(IN_B_INPUT, GTX__N)].value) >= 1.0f;
+			bool inA = routes(IN_A_INPUT, i).value >= 1.0f;
+			bool inB = routes(IN_B_INPUT, i).value >= 1.0f;
 
 			inA  ^= (params[INVERT_A_PARAM].value < 0.5f);
 			inB  ^= (params[INVERT_B_PARAM].value < 0.5f);
@@ -131,9 +139,11 @@ struct GtxModule : Module
 //============================================================================================================
 //! \brief The widget.
 
+#if GTX__WIDGETS
+template <std::size_t N>
 struct GtxWidget : ModuleWidget
 {
-	GtxWidget(GtxModule *module) : ModuleWidget(module)
+	GtxWidget(GtxModule<N> *module) : ModuleWidget(module)
 	{
 		GTX__WIDGET();
 		box.size = Vec(12*15, 380);
@@ -172,41 +182,51 @@ struct GtxWidget : ModuleWidget
 		addChild(Widget::create<ScrewSilver>(Vec(15, 365)));
 		addChild(Widget::create<ScrewSilver>(Vec(box.size.x-30, 365)));
 
-		addParam(ParamWidget::create<CKSS>(  tog(fx(1 - 1.27)    , fy(-0.28)), module, GtxModule::INVERT_A_PARAM,      0.0, 1.0, 1.0));
-		addParam(ParamWidget::create<CKSS>(  tog(fx(1 - 1.27)    , fy(+0.28)), module, GtxModule::INVERT_B_PARAM,      0.0, 1.0, 1.0));
-		addParam(createParamGTX<KnobSnapSml>(Vec(fx(1 - 0.75) - 3, fy(-0.28)), module, GtxModule::FUNCTION_AB_1_PARAM, 0.0, 4.0, 2.0));
-		addParam(createParamGTX<KnobSnapSml>(Vec(fx(1 - 0.75) - 3, fy(+0.28)), module, GtxModule::FUNCTION_AB_2_PARAM, 0.0, 4.0, 2.0));
-		addParam(ParamWidget::create<CKSS>(  tog(fx(    1.27)    , fy(-0.28)), module, GtxModule::INVERT_1_PARAM,      0.0, 1.0, 1.0));
-		addParam(ParamWidget::create<CKSS>(  tog(fx(    1.27)    , fy(+0.28)), module, GtxModule::INVERT_2_PARAM,      0.0, 1.0, 1.0));
+		addParam(ParamWidget::create<CKSS>(  tog(fx(1 - 1.27)    , fy(-0.28)), module, GtxModule<N>::INVERT_A_PARAM,      0.0, 1.0, 1.0));
+		addParam(ParamWidget::create<CKSS>(  tog(fx(1 - 1.27)    , fy(+0.28)), module, GtxModule<N>::INVERT_B_PARAM,      0.0, 1.0, 1.0));
+		addParam(createParamGTX<KnobSnapSml>(Vec(fx(1 - 0.75) - 3, fy(-0.28)), module, GtxModule<N>::FUNCTION_AB_1_PARAM, 0.0, 4.0, 2.0));
+		addParam(createParamGTX<KnobSnapSml>(Vec(fx(1 - 0.75) - 3, fy(+0.28)), module, GtxModule<N>::FUNCTION_AB_2_PARAM, 0.0, 4.0, 2.0));
+		addParam(ParamWidget::create<CKSS>(  tog(fx(    1.27)    , fy(-0.28)), module, GtxModule<N>::INVERT_1_PARAM,      0.0, 1.0, 1.0));
+		addParam(ParamWidget::create<CKSS>(  tog(fx(    1.27)    , fy(+0.28)), module, GtxModule<N>::INVERT_2_PARAM,      0.0, 1.0, 1.0));
 
-		for (std::size_t i=0; i<GTX__N; ++i)
+		for (std::size_t i=0; i<N; ++i)
 		{
-			addInput(createInputGTX<PortInMed>(Vec(px(0, i), py(1, i)), module, GtxModule::imap(GtxModule::IN_A_INPUT, i)));
-			addInput(createInputGTX<PortInMed>(Vec(px(0, i), py(2, i)), module, GtxModule::imap(GtxModule::IN_B_INPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(0, i, N), py(1, i, N)), module, GtxModule<N>::imap(GtxModule<N>::IN_A_INPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(0, i, N), py(2, i, N)), module, GtxModule<N>::imap(GtxModule<N>::IN_B_INPUT, i)));
 
-			addOutput(createOutputGTX<PortOutMed>(Vec(px(1, i), py(1, i)), module, GtxModule::omap(GtxModule::OUT_1_OUTPUT, i)));
-			addOutput(createOutputGTX<PortOutMed>(Vec(px(1, i), py(2, i)), module, GtxModule::omap(GtxModule::OUT_2_OUTPUT, i)));
+			addOutput(createOutputGTX<PortOutVoice<N>>(Vec(px(1, i, N), py(1, i, N)), module, GtxModule<N>::omap(GtxModule<N>::OUT_1_OUTPUT, i)));
+			addOutput(createOutputGTX<PortOutVoice<N>>(Vec(px(1, i, N), py(2, i, N)), module, GtxModule<N>::omap(GtxModule<N>::OUT_2_OUTPUT, i)));
 		}
 
-		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(1)), module, GtxModule::imap(GtxModule::IN_A_INPUT, GTX__N)));
-		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(2)), module, GtxModule::imap(GtxModule::IN_B_INPUT, GTX__N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(1)), module, GtxModule<N>::imap(GtxModule<N>::IN_A_INPUT, N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(2)), module, GtxModule<N>::imap(GtxModule<N>::IN_B_INPUT, N)));
 
-		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(-0.28) - 6 * rad_l_s()), module, GtxModule::FUNCTION_0_AB_1_LIGHT));
-		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(-0.28) - 3 * rad_l_s()), module, GtxModule::FUNCTION_1_AB_1_LIGHT));
-		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(-0.28) - 0 * rad_l_s()), module, GtxModule::FUNCTION_2_AB_1_LIGHT));
-		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(-0.28) + 3 * rad_l_s()), module, GtxModule::FUNCTION_3_AB_1_LIGHT));
-		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(-0.28) + 6 * rad_l_s()), module, GtxModule::FUNCTION_4_AB_1_LIGHT));
+		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(-0.28) - 6 * rad_l_s()), module, GtxModule<N>::FUNCTION_0_AB_1_LIGHT));
+		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(-0.28) - 3 * rad_l_s()), module, GtxModule<N>::FUNCTION_1_AB_1_LIGHT));
+		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(-0.28) - 0 * rad_l_s()), module, GtxModule<N>::FUNCTION_2_AB_1_LIGHT));
+		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(-0.28) + 3 * rad_l_s()), module, GtxModule<N>::FUNCTION_3_AB_1_LIGHT));
+		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(-0.28) + 6 * rad_l_s()), module, GtxModule<N>::FUNCTION_4_AB_1_LIGHT));
 
-		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(+0.28) - 6 * rad_l_s()), module, GtxModule::FUNCTION_0_AB_2_LIGHT));
-		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(+0.28) - 3 * rad_l_s()), module, GtxModule::FUNCTION_1_AB_2_LIGHT));
-		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(+0.28) - 0 * rad_l_s()), module, GtxModule::FUNCTION_2_AB_2_LIGHT));
-		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(+0.28) + 3 * rad_l_s()), module, GtxModule::FUNCTION_3_AB_2_LIGHT));
-		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(+0.28) + 6 * rad_l_s()), module, GtxModule::FUNCTION_4_AB_2_LIGHT));
+		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(+0.28) - 6 * rad_l_s()), module, GtxModule<N>::FUNCTION_0_AB_2_LIGHT));
+		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(+0.28) - 3 * rad_l_s()), module, GtxModule<N>::FUNCTION_1_AB_2_LIGHT));
+		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(+0.28) - 0 * rad_l_s()), module, GtxModule<N>::FUNCTION_2_AB_2_LIGHT));
+		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(+0.28) + 3 * rad_l_s()), module, GtxModule<N>::FUNCTION_3_AB_2_LIGHT));
+		addChild(ModuleLightWidget::create<SmallLight<GreenLight>>(l_s(fx(0.72) - 2.5 * rad_l_s() - 5, fy(+0.28) + 6 * rad_l_s()), module, GtxModule<N>::FUNCTION_4_AB_2_LIGHT));
+	}
+
+	void appendContextMenu(Menu *menu) override
+	{
+		appendProfileMenu(menu, static_cast<GtxModule<N> *>(module)->profile);
 	}
 };
+#else
+template <std::size_t N> struct GtxWidget;
+#endif
 
 
-Model *model = Model::create<GtxModule, GtxWidget>("Gratrix", "Binary-G1", "Binary-G1", LOGIC_TAG);
+Model *model    = Model::create<GtxModule<GTX__N>, GtxWidget<GTX__N>>("Gratrix", "Binary-G1",    "Binary-G1",    LOGIC_TAG);
+Model *model_8  = Model::create<GtxModule<8>,      GtxWidget<8>>     ("Gratrix", "Binary-G1-8",  "Binary-G1-8",  LOGIC_TAG);
+Model *model_16 = Model::create<GtxModule<16>,     GtxWidget<16>>    ("Gratrix", "Binary-G1-16", "Binary-G1-16", LOGIC_TAG);
 
 
 } // Binary_G1
@@ -26,6 +26,7 @@ struct GtxModule : Module
 //============================================================================================================
 //! \brief The widget.
 
+#if GTX__WIDGETS
 struct GtxWidget : ModuleWidget
 {
 	GtxWidget(GtxModule *module) : ModuleWidget(module)
@@ -47,6 +48,9 @@ struct GtxWidget : ModuleWidget
 		addChild(Widget::create<ScrewSilver>(Vec(box.size.x-30, 365)));
 	}
 };
+#else
+struct GtxWidget;
+#endif
 
 
 Model *model = Model::create<GtxModule, GtxWidget>("Gratrix", "Blank12", "Blank 12", BLANK_TAG);
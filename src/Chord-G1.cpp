@@ -88,6 +88,7 @@ struct GtxModule : Module
 	SchmittTrigger note_trigger[T];
 	bool  note_enable[E][T] = {};
 	float gen[N] = {0,1,2,3,4,5};
+	StepProfile profile{this};
 
 	//--------------------------------------------------------------------------------------------------------
 	//! \brief Constructor.
@@ -157,6 +158,8 @@ struct GtxModule : Module
 
 	void step() override
 	{
+		StepTimer timer(profile);
+
 		// Clear all lights
 
 		float leds[NUM_LIGHTS] = {};
@@ -271,6 +274,7 @@ struct GtxModule : Module
 };
 
 
+#if GTX__WIDGETS
 //============================================================================================================
 
 static double x0(double shift = 0) { return 6+6*15 + shift * 66; }
@@ -365,7 +369,15 @@ struct GtxWidget : ModuleWidget
 		addChild(ModuleLightWidget::create<SmallLight<     RedLight>>(l_s(x0() + 25, fy(+0.28) - 5), module, GtxModule::FUND_LIGHT + 10));  // Bb
 		addChild(ModuleLightWidget::create<SmallLight<     RedLight>>(l_s(x0() + 30, fy(+0.28) + 5), module, GtxModule::FUND_LIGHT + 11));  // B
 	}
+
+	void appendContextMenu(Menu *menu) override
+	{
+		appendProfileMenu(menu, static_cast<GtxModule *>(module)->profile);
+	}
 };
+#else
+struct GtxWidget;
+#endif
 
 
 Model *model = Model::create<GtxModule, GtxWidget>("Gratrix", "Chord-G1", "Chord-G1", SYNTH_VOICE_TAG);  // right tag?
@@ -2,7 +2,7 @@
 //!
 //! \file Fade-G1.cpp
 //!
-//! \brief Fade-G1 is a two input six voice one-dimensional fader.
+//! \brief Fade-G1 is a two input six, eight or sixteen voice one-dimensional fader.
 //!
 //============================================================================================================
 
@@ -17,7 +17,8 @@ namespace Fade_G1 {
 //============================================================================================================
 //! \brief The module.
 
-struct GtxModule : Module
+template <std::size_t N>
+struct GtxModule : Module, Voices<N>
 {
 	enum ParamIds {
 		BLEND12_PARAM,
@@ -44,11 +45,15 @@ struct GtxModule : Module
 		NUM_LIGHTS
 	};
 
+	RouteTable<N, NUM_INPUTS> routes;
+	VoiceMask<N, NUM_INPUTS, NUM_OUTPUTS> voices;
+	StepProfile profile{this};
+
 	GtxModule()
 	:
 		Module(NUM_PARAMS,
-		(GTX__N+1) * (NUM_INPUTS  - OFF_INPUTS ) + OFF_INPUTS,
-		(GTX__N  ) * (NUM_OUTPUTS - OFF_OUTPUTS) + OFF_OUTPUTS,
+		(N+1) * (NUM_INPUTS  - OFF_INPUTS ) + OFF_INPUTS,
+		(N  ) * (NUM_OUTPUTS - OFF_OUTPUTS) + OFF_OUTPUTS,
 		NUM_LIGHTS)
 	{
 		lights[IN_1_GREEN].value = 0.0f;  lights[IN_1_RED].value = 1.0f;
@@ -67,14 +72,21 @@ struct GtxModule : Module
 
 	void step() override
 	{
+		StepTimer timer(profile);
+
+		routes.update(*this, OFF_INPUTS, NUM_INPUTS);
+		voices.update(*this);
+
 		float blend12 = params[BLEND12_PARAM].value;
 
 		if (inputs[BLEND12_INPUT].active) blend12 *= clamp(inputs[BLEND12_INPUT].normalize(10.0f) / 10.0f, 0.0f, 1.0f);
 
-		for (std::size_t i=0; i<GTX__N; ++i)
+		for (std::size_t i=0; i<N; ++i)
 		{
-			float input1 = inputs[imap(IN1_INPUT, i)].active ? inputs[imap(IN1_INPUT, i)].value : inputs[imap(IN1_INPUT, GTX__N)].value;
-			float input2 = inputs[imap(IN2_INPUT, i)].active ? inputs[imap(IN2_INPUT, i)].value : inputs[imap(IN2_INPUT, GTX__N)].value;
+			if (!voices[i]) continue;
+
+			float input1 = routes(IN1_INPUT, i).value;
+			float input2 = routes(IN2_INPUT, i).value;
 
 			float delta12 = blend12 * (input2 - input1);
 
@@ -91,9 +103,11 @@ struct GtxModule : Module
 //============================================================================================================
 //! \brief The widget.
 
+#if GTX__WIDGETS
+template <std::size_t N>
 struct GtxWidget : ModuleWidget
 {
-	GtxWidget(GtxModule *module) : ModuleWidget(module)
+	GtxWidget(GtxModule<N> *module) : ModuleWidget(module)
 	{
 		GTX__WIDGET();
 		box.size = Vec(12*15, 380);
@@ -117,21 +131,21 @@ struct GtxWidget : ModuleWidget
 		addChild(Widget::create<ScrewSilver>(Vec(15, 365)));
 		addChild(Widget::create<ScrewSilver>(Vec(box.size.x-30, 365)));
 
-		addParam(createParamGTX<KnobFreeHug>(Vec(fx(1), fy(0)), module, GtxModule::BLEND12_PARAM, 0.0f, 1.0f, 0.0f));
+		addParam(createParamGTX<KnobFreeHug>(Vec(fx(1), fy(0)), module, GtxModule<N>::BLEND12_PARAM, 0.0f, 1.0f, 0.0f));
 
-		addInput(createInputGTX<PortInMed>(Vec(fx(0), fy(0)), module, GtxModule::BLEND12_INPUT));
+		addInput(createInputGTX<PortInMed>(Vec(fx(0), fy(0)), module, GtxModule<N>::BLEND12_INPUT));
 
-		for (std::size_t i=0; i<GTX__N; ++i)
+		for (std::size_t i=0; i<N; ++i)
 		{
-			addInput(createInputGTX<PortInMed>(Vec(px(0, i), py(1, i)), module, GtxModule::imap(GtxModule::IN1_INPUT, i)));
-			addInput(createInputGTX<PortInMed>(Vec(px(0, i), py(2, i)), module, GtxModule::imap(GtxModule::IN2_INPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(0, i, N), py(1, i, N)), module, GtxModule<N>::imap(GtxModule<N>::IN1_INPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(0, i, N), py(2, i, N)), module, GtxModule<N>::imap(GtxModule<N>::IN2_INPUT, i)));
 
-			addOutput(createOutputGTX<PortOutMed>(Vec(px(1, i), py(1, i)), module, GtxModule::omap(GtxModule::OUT1_OUTPUT, i)));
-			addOutput(createOutputGTX<PortOutMed>(Vec(px(1, i), py(2, i)), module, GtxModule::omap(GtxModule::OUT2_OUTPUT, i)));
+			addOutput(createOutputGTX<PortOutVoice<N>>(Vec(px(1, i, N), py(1, i, N)), module, GtxModule<N>::omap(GtxModule<N>::OUT1_OUTPUT, i)));
+			addOutput(createOutputGTX<PortOutVoice<N>>(Vec(px(1, i, N), py(2, i, N)), module, GtxModule<N>::omap(GtxModule<N>::OUT2_OUTPUT, i)));
 		}
 
-		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(1)), module, GtxModule::imap(GtxModule::IN1_INPUT, GTX__N)));
-		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(2)), module, GtxModule::imap(GtxModule::IN2_INPUT, GTX__N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(1)), module, GtxModule<N>::imap(GtxModule<N>::IN1_INPUT, N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(2)), module, GtxModule<N>::imap(GtxModule<N>::IN2_INPUT, N)));
 
 		for (std::size_t i=0, x=0; x<2; ++x)
 		{
@@ -141,10 +155,20 @@ struct GtxWidget : ModuleWidget
 			}
 		}
 	}
+
+	void appendContextMenu(Menu *menu) override
+	{
+		appendProfileMenu(menu, static_cast<GtxModule<N> *>(module)->profile);
+	}
 };
+#else
+template <std::size_t N> struct GtxWidget;
+#endif
 
 
-Model *model = Model::create<GtxModule, GtxWidget>("Gratrix", "Fade-G1", "Fade-G1", MIXER_TAG);  // right tag?
+Model *model    = Model::create<GtxModule<GTX__N>, GtxWidget<GTX__N>>("Gratrix", "Fade-G1",    "Fade-G1",    MIXER_TAG);  // right tag?
+Model *model_8  = Model::create<GtxModule<8>,      GtxWidget<8>>     ("Gratrix", "Fade-G1-8",  "Fade-G1-8",  MIXER_TAG);  // right tag?
+Model *model_16 = Model::create<GtxModule<16>,     GtxWidget<16>>    ("Gratrix", "Fade-G1-16", "Fade-G1-16", MIXER_TAG);  // right tag?
 
 
 } // Fade_G1
@@ -2,7 +2,7 @@
 //!
 //! \file Fade-G2.cpp
 //!
-//! \brief Fade-G2 is a four input six voice two-dimensional fader.
+//! \brief Fade-G2 is a four input six, eight or sixteen voice two-dimensional fader.
 //!
 //============================================================================================================
 
@@ -17,7 +17,8 @@ namespace Fade_G2 {
 //============================================================================================================
 //! \brief The module.
 
-struct GtxModule : Module
+template <std::size_t N>
+struct GtxModule : Module, Voices<N>
 {
 	enum ParamIds {
 		BLEND12_PARAM,
@@ -56,11 +57,15 @@ struct GtxModule : Module
 		NUM_LIGHTS
 	};
 
+	RouteTable<N, NUM_INPUTS> routes;
+	VoiceMask<N, NUM_INPUTS, NUM_OUTPUTS> voices;
+	StepProfile profile{this};
+
 	GtxModule()
 	:
 		Module(NUM_PARAMS,
-		(GTX__N+1) * (NUM_INPUTS  - OFF_INPUTS ) + OFF_INPUTS,
-		(GTX__N  ) * (NUM_OUTPUTS - OFF_OUTPUTS) + OFF_OUTPUTS,
+		(N+1) * (NUM_INPUTS  - OFF_INPUTS ) + OFF_INPUTS,
+		(N  ) * (NUM_OUTPUTS - OFF_OUTPUTS) + OFF_OUTPUTS,
 		NUM_LIGHTS)
 	{
 		lights[IN_1AP_GREEN].value = 0.0f;  lights[IN_1AP_RED].value = 1.0f;
@@ -85,18 +90,25 @@ struct GtxModule : Module
 
 	void step() override
 	{
+		StepTimer timer(profile);
+
+		routes.update(*this, OFF_INPUTS, NUM_INPUTS);
+		voices.update(*this);
+
 		float blend12 = params[BLEND12_PARAM].value;
 		float blendAB = params[BLENDAB_PARAM].value;
 
 		if (inputs[BLEND12_INPUT].active) blend12 *= clamp(inputs[BLEND12_INPUT].normalize(10.0f) / 10.0f, 0.0f, 1.0f);
 		if (inputs[BLENDAB_INPUT].active) blendAB *= clamp(inputs[BLENDAB_INPUT].normalize(10.0f) / 10.0f, 0.0f, 1.0f);
 
-		for (std::size_t i=0; i<GTX__N; ++i)
+		for (std::size_t i=0; i<N; ++i)
 		{
-			float input1A  = inputs[imap(IN1A_INPUT, i)].active ? inputs[imap(IN1A_INPUT, i)].value : inputs[imap(IN1A_INPUT, GTX__N)].value;
-			float input1B  = inputs[imap(IN1B_INPUT, i)].active ? inputs[imap(IN1B_INPUT, i)].value : inputs[imap(IN1B_INPUT, GTX__N)].value;
-			float input2A  = inputs[imap(IN2A_INPUT, i)].active ? inputs[imap(IN2A_INPUT, i)].value : inputs[imap(IN2A_INPUT, GTX__N)].value;
-			float input2B  = inputs[imap(IN2B_INPUT, i)].active ? inputs[imap(IN2B_INPUT, i)].value : inputs[imap(IN2B_INPUT, GTX__N)].value;
+			if (!voices[i]) continue;
+
+			float input1A  = routes(IN1A_INPUT, i).value;
+			float input1B  = routes(IN1B_INPUT, i).value;
+			float input2A  = routes(IN2A_INPUT, i).value;
+			float input2B  = routes(IN2B_INPUT, i).value;
 
 			float delta1AB = blendAB * (input1B - input1A);
 			float delta2AB = blendAB * (input2B - input2A);
@@ -124,9 +136,11 @@ struct GtxModule : Module
 //============================================================================================================
 //! \brief The widget.
 
+#if GTX__WIDGETS
+template <std::size_t N>
 struct GtxWidget : ModuleWidget
 {
-	GtxWidget(GtxModule *module) : ModuleWidget(module)
+	GtxWidget(GtxModule<N> *module) : ModuleWidget(module)
 	{
 		GTX__WIDGET();
 		box.size = Vec(18*15, 380);
@@ -153,27 +167,27 @@ struct GtxWidget : ModuleWidget
 		addChild(Widget::create<ScrewSilver>(Vec(15, 365)));
 		addChild(Widget::create<ScrewSilver>(Vec(box.size.x-30, 365)));
 
-		addParam(createParamGTX<KnobFreeHug>(Vec(fx(1), fy(0)), module, GtxModule::BLENDAB_PARAM, 0.0f, 1.0f, 0.0f));
-		addParam(createParamGTX<KnobFreeHug>(Vec(fx(2), fy(0)), module, GtxModule::BLEND12_PARAM, 0.0f, 1.0f, 0.0f));
+		addParam(createParamGTX<KnobFreeHug>(Vec(fx(1), fy(0)), module, GtxModule<N>::BLENDAB_PARAM, 0.0f, 1.0f, 0.0f));
+		addParam(createParamGTX<KnobFreeHug>(Vec(fx(2), fy(0)), module, GtxModule<N>::BLEND12_PARAM, 0.0f, 1.0f, 0.0f));
 
-		addInput(createInputGTX<PortInMed>(Vec(fx(0), fy(-0.28)), module, GtxModule::BLENDAB_INPUT));
-		addInput(createInputGTX<PortInMed>(Vec(fx(0), fy(+0.28)), module, GtxModule::BLEND12_INPUT));
+		addInput(createInputGTX<PortInMed>(Vec(fx(0), fy(-0.28)), module, GtxModule<N>::BLENDAB_INPUT));
+		addInput(createInputGTX<PortInMed>(Vec(fx(0), fy(+0.28)), module, GtxModule<N>::BLEND12_INPUT));
 
-		for (std::size_t i=0; i<GTX__N; ++i)
+		for (std::size_t i=0; i<N; ++i)
 		{
-			addInput(createInputGTX<PortInMed>(Vec(px(0, i), py(1, i)), module, GtxModule::imap(GtxModule::IN1A_INPUT, i)));
-			addInput(createInputGTX<PortInMed>(Vec(px(0, i), py(2, i)), module, GtxModule::imap(GtxModule::IN1B_INPUT, i)));
-			addInput(createInputGTX<PortInMed>(Vec(px(1, i), py(1, i)), module, GtxModule::imap(GtxModule::IN2A_INPUT, i)));
-			addInput(createInputGTX<PortInMed>(Vec(px(1, i), py(2, i)), module, GtxModule::imap(GtxModule::IN2B_INPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(0, i, N), py(1, i, N)), module, GtxModule<N>::imap(GtxModule<N>::IN1A_INPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(0, i, N), py(2, i, N)), module, GtxModule<N>::imap(GtxModule<N>::IN1B_INPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(1, i, N), py(1, i, N)), module, GtxModule<N>::imap(GtxModule<N>::IN2A_INPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(1, i, N), py(2, i, N)), module, GtxModule<N>::imap(GtxModule<N>::IN2B_INPUT, i)));
 
-			addOutput(createOutputGTX<PortOutMed>(Vec(px(2, i), py(1, i)), module, GtxModule::omap(GtxModule::OUT1A_OUTPUT, i)));
-			addOutput(createOutputGTX<PortOutMed>(Vec(px(2, i), py(2, i)), module, GtxModule::omap(GtxModule::OUT2B_OUTPUT, i)));
+			addOutput(createOutputGTX<PortOutVoice<N>>(Vec(px(2, i, N), py(1, i, N)), module, GtxModule<N>::omap(GtxModule<N>::OUT1A_OUTPUT, i)));
+			addOutput(createOutputGTX<PortOutVoice<N>>(Vec(px(2, i, N), py(2, i, N)), module, GtxModule<N>::omap(GtxModule<N>::OUT2B_OUTPUT, i)));
 		}
 
-		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(1)), module, GtxModule::imap(GtxModule::IN1A_INPUT, GTX__N)));
-		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(2)), module, GtxModule::imap(GtxModule::IN1B_INPUT, GTX__N)));
-		addInput(createInputGTX<PortInMed>(Vec(gx(1), gy(1)), module, GtxModule::imap(GtxModule::IN2A_INPUT, GTX__N)));
-		addInput(createInputGTX<PortInMed>(Vec(gx(1), gy(2)), module, GtxModule::imap(GtxModule::IN2B_INPUT, GTX__N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(1)), module, GtxModule<N>::imap(GtxModule<N>::IN1A_INPUT, N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(2)), module, GtxModule<N>::imap(GtxModule<N>::IN1B_INPUT, N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(1), gy(1)), module, GtxModule<N>::imap(GtxModule<N>::IN2A_INPUT, N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(1), gy(2)), module, GtxModule<N>::imap(GtxModule<N>::IN2B_INPUT, N)));
 
 		for (std::size_t i=0, x=0; x<3; ++x)
 		{
@@ -184,10 +198,20 @@ struct GtxWidget : ModuleWidget
 			}
 		}
 	}
+
+	void appendContextMenu(Menu *menu) override
+	{
+		appendProfileMenu(menu, static_cast<GtxModule<N> *>(module)->profile);
+	}
 };
+#else
+template <std::size_t N> struct GtxWidget;
+#endif
 
 
-Model *model = Model::create<GtxModule, GtxWidget>("Gratrix", "Fade-G2", "Fade-G2", MIXER_TAG);  // right tag?
+Model *model    = Model::create<GtxModule<GTX__N>, GtxWidget<GTX__N>>("Gratrix", "Fade-G2",    "Fade-G2",    MIXER_TAG);  // right tag?
+Model *model_8  = Model::create<GtxModule<8>,      GtxWidget<8>>     ("Gratrix", "Fade-G2-8",  "Fade-G2-8",  MIXER_TAG);  // right tag?
+Model *model_16 = Model::create<GtxModule<16>,     GtxWidget<16>>    ("Gratrix", "Fade-G2-16", "Fade-G2-16", MIXER_TAG);  // right tag?
 
 
 } // Fade_G2
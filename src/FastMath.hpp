@@ -0,0 +1,228 @@
+#ifndef GTX__FASTMATH_HPP
+#define GTX__FASTMATH_HPP
+
+
+#include <cstdint>
+#include <cstring>
+
+
+//============================================================================================================
+//! \brief Branch-free approximations of the transcendentals on the DSP hot paths.
+//!
+//! Every function is a plain inline scalar built from selects, bit casts and a polynomial, so loops over
+//! voice lanes vectorise with SSE2 (no floor or round instructions needed).  Each comes at three accuracy
+//! tiers picked by template argument, the errors below are the worst seen over the stated range with float
+//! arithmetic, measured by bench/fastmath.cpp ("make fastmath").
+//!
+//!   function     range              COARSE          MEDIUM          FINE
+//!   exp2(x)      [-125, 126]        1.7e-3 rel      7.5e-5 rel      1.8e-7 rel
+//!   log2(x)      [0.5, 2)           7.7e-4 abs      1.4e-5 abs      1.7e-7 abs
+//!   sin2pi(p)    [-64, 64]          6.8e-5 abs      7.3e-7 abs      2.0e-7 abs
+//!   tanh(x)      all x              2.4e-2 abs      9.6e-5 abs      1.9e-7 abs
+//!
+//! log2 adds the exponent exactly, so outside [0.5, 2) its error only grows by the rounding of the sum.
+//! For scale, 1e-4 relative on a frequency is 0.17 cent, and 1e-5 absolute on a sine is -100 dB.
+
+namespace GTX {
+namespace fastmath {
+
+
+enum Precision
+{
+	COARSE,  // Meters and other control paths
+	MEDIUM,  // Audio paths where a little colouring is inaudible
+	FINE     // Within a few float ulps, pitch and oscillators
+};
+
+
+//============================================================================================================
+//! \name Polynomial kernels, Horner form, minimax over the reduced ranges.
+
+template <int P> struct Exp2Poly;  // 2^f for f in [0, 1)
+template <int P> struct Log2Poly;  // log2(1 + t) for t in [0, 1)
+template <int P> struct SinPoly;   // sin(2 pi r) for r in [-1/4, 1/4]
+
+template <> struct Exp2Poly<COARSE>
+{
+	static float eval(float f)
+	{
+		return 1.001722872f + f * (6.576391404e-01f + f * 3.371922393e-01f);
+	}
+};
+
+template <> struct Exp2Poly<MEDIUM>
+{
+	static float eval(float f)
+	{
+		return 9.999253112e-01f + f * (6.958330508e-01f + f * (2.260674479e-01f + f * 7.802481235e-02f));
+	}
+};
+
+template <> struct Exp2Poly<FINE>
+{
+	static float eval(float f)
+	{
+		return 9.999999252e-01f + f * (6.931530715e-01f + f * (2.401536243e-01f + f * (5.582630813e-02f
+			+ f * (8.989342488e-03f + f * 1.877578766e-03f))));
+	}
+};
+
+template <> struct Log2Poly<COARSE>
+{
+	static float eval(float t)
+	{
+		return t * (1.424591614f + t * (-5.891972629e-01f + t * 1.653754556e-01f));
+	}
+};
+
+template <> struct Log2Poly<MEDIUM>
+{
+	static float eval(float t)
+	{
+		return t * (1.441965550f + t * (-7.096620499e-01f + t * (4.175930732e-01f + t * (-1.962659556e-01f
+			+ t * 4.638366222e-02f))));
+	}
+};
+
+template <> struct Log2Poly<FINE>
+{
+	static float eval(float t)
+	{
+		return t * (1.442689879f + t * (-7.211657541e-01f + t * (4.786832936e-01f + t * (-3.472995111e-01f
+			+ t * (2.418614210e-01f + t * (-1.375173541e-01f + t * (5.205650998e-02f + t * -9.308530357e-03f)))))));
+	}
+};
+
+template <> struct SinPoly<COARSE>
+{
+	static float eval(float r)
+	{
+		float r2 = r * r;
+		return r * (6.281279706f + r2 * (-4.109521074e+01f + r2 * 7.358499993e+01f));
+	}
+};
+
+template <> struct SinPoly<MEDIUM>
+{
+	static float eval(float r)
+	{
+		float r2 = r * r;
+		return r * (6.283164041f + r2 * (-4.133714184e+01f + r2 * (8.134074821e+01f + r2 * -7.099321158e+01f)));
+	}
+};
+
+template <> struct SinPoly<FINE>
+{
+	static float eval(float r)
+	{
+		float r2 = r * r;
+		return r * (6.283185160f + r2 * (-4.134165503e+01f + r2 * (8.160100387e+01f + r2 * (-7.654977675e+01f
+			+ r2 * 3.953665886e+01f))));
+	}
+};
+
+
+//============================================================================================================
+//! \name Bit casts and rounding without SSE4.1.
+
+inline float as_float(std::int32_t i)
+{
+	float f;
+	std::memcpy(&f, &i, sizeof(f));
+	return f;
+}
+
+inline std::int32_t as_int(float f)
+{
+	std::int32_t i;
+	std::memcpy(&i, &f, sizeof(i));
+	return i;
+}
+
+//! \brief Largest integer not above x, for |x| < 2^31.
+inline float floor(float x)
+{
+	float t = static_cast<float>(static_cast<std::int32_t>(x));
+	return t - (t > x ? 1.0f : 0.0f);
+}
+
+
+//============================================================================================================
+//! \name The functions.
+
+//! \brief 2^x, clamped to stay a normal float.
+template <int P = FINE> inline float exp2(float x)
+{
+	x = x < -125.0f ? -125.0f : x;
+	x = x >  126.0f ?  126.0f : x;
+
+	float whole = floor(x);
+
+	return as_float((static_cast<std::int32_t>(whole) + 127) << 23) * Exp2Poly<P>::eval(x - whole);
+}
+
+//! \brief b^x given log2(b), which callers hoist out of their loops.
+template <int P = FINE> inline float pow(float log2b, float x)
+{
+	return exp2<P>(log2b * x);
+}
+
+//! \brief log2 of |x|, zero and denormals come out near -127 rather than minus infinity.
+template <int P = FINE> inline float log2(float x)
+{
+	std::int32_t i = as_int(x);
+	float exponent = static_cast<float>(((i >> 23) & 255) - 127);
+
+	return exponent + Log2Poly<P>::eval(as_float((i & 0x007FFFFF) | 0x3F800000) - 1.0f);
+}
+
+//! \brief sin(2 pi p), p in cycles.
+template <int P = FINE> inline float sin2pi(float p)
+{
+	// Nearest whole cycle away, then fold the outer quarters back onto the odd polynomial's range
+	float r = p - floor(p + 0.5f);
+
+	r = r >  0.25f ?  0.5f - r : r;
+	r = r < -0.25f ? -0.5f - r : r;
+
+	return SinPoly<P>::eval(r);
+}
+
+//! \brief tanh(x), saturating to exactly +/-1.
+template <int P = FINE> inline float tanh(float x);
+
+template <> inline float tanh<COARSE>(float x)
+{
+	// Pade style fit that meets 1 with zero slope at 3
+	x = x < -3.0f ? -3.0f : x;
+	x = x >  3.0f ?  3.0f : x;
+
+	float x2 = x * x;
+	return x * (27.0f + x2) / (27.0f + 9.0f * x2);
+}
+
+template <> inline float tanh<MEDIUM>(float x)
+{
+	// [7/6] Pade approximant, clamped where it reaches 1
+	x = x < -4.97f ? -4.97f : x;
+	x = x >  4.97f ?  4.97f : x;
+
+	float x2 = x * x;
+	return x * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)))
+		/ (135135.0f + x2 * (62370.0f + x2 * (3150.0f + x2 * 28.0f)));
+}
+
+template <> inline float tanh<FINE>(float x)
+{
+	// Through e^2x, small values lose their low bits to the cancellation but are their own tanh there
+	float t = 1.0f - 2.0f / (exp2<FINE>(2.885390082f * x) + 1.0f);
+
+	return (x > -1e-3f && x < 1e-3f) ? x : t;
+}
+
+
+} // fastmath
+} // GTX
+
+
+#endif
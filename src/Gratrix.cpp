@@ -12,15 +12,31 @@ void init(rack::Plugin *p)
 //	p->addModel(GTX::MIDI_C1  ::model);
 //	p->addModel(GTX::MIDI_G1  ::model);
 	p->addModel(GTX::VCO_F1   ::model);
+	p->addModel(GTX::VCO_F1   ::model_8);
+	p->addModel(GTX::VCO_F1   ::model_16);
 	p->addModel(GTX::VCO_F2   ::model);
+	p->addModel(GTX::VCO_F2   ::model_8);
+	p->addModel(GTX::VCO_F2   ::model_16);
 	p->addModel(GTX::VCF_F1   ::model);
+	p->addModel(GTX::VCF_F1   ::model_8);
+	p->addModel(GTX::VCF_F1   ::model_16);
 	p->addModel(GTX::VCA_F1   ::model);
+	p->addModel(GTX::VCA_F1   ::model_8);
+	p->addModel(GTX::VCA_F1   ::model_16);
 	p->addModel(GTX::ADSR_F1  ::model);
+	p->addModel(GTX::ADSR_F1  ::model_8);
+	p->addModel(GTX::ADSR_F1  ::model_16);
 	p->addModel(GTX::Chord_G1 ::model);
 	p->addModel(GTX::Octave_G1::model);
 	p->addModel(GTX::Fade_G1  ::model);
+	p->addModel(GTX::Fade_G1  ::model_8);
+	p->addModel(GTX::Fade_G1  ::model_16);
 	p->addModel(GTX::Fade_G2  ::model);
+	p->addModel(GTX::Fade_G2  ::model_8);
+	p->addModel(GTX::Fade_G2  ::model_16);
 	p->addModel(GTX::Binary_G1::model);
+	p->addModel(GTX::Binary_G1::model_8);
+	p->addModel(GTX::Binary_G1::model_16);
 	p->addModel(GTX::Seq_G1   ::model);
 	p->addModel(GTX::Seq_G2   ::model);
 	p->addModel(GTX::Keys_G1  ::model);
@@ -0,0 +1,1354 @@
+#ifndef GTX__GRATRIX_DSP_HPP
+#define GTX__GRATRIX_DSP_HPP
+
+
+//============================================================================================================
+//! \brief The part of Gratrix.hpp the module DSP needs: bank voices, lanes, blocks, control rate, profiling.
+//!
+//! Built alone by "make dsp", the widgets being in GratrixWidgets.hpp and the panel generator in
+//! PanelGen.hpp so neither is parsed where it is not used.
+
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <array>
+#include <algorithm>
+#include <type_traits>
+#include <cmath>
+#include <limits>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <typeinfo>
+#include <cxxabi.h>
+#include "rack.hpp"
+#include "FastMath.hpp"
+
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#include <x86intrin.h>
+#endif
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+
+#define GTX__N          6  // Voices per bank for modules not templated on voice count, and the default model
+#define GTX__SIMD       4  // Floats per SSE register
+#define GTX__BLOCK      64 // Most frames a bank buffers in block mode
+#define GTX__THREADS    4  // Most threads a bank splits its voices over, the audio thread included
+#define GTX__FPS        60 // Frames a second displays are drawn at, and snapshots of their state published
+#define GTX__2PI        6.283185307179586476925
+#define GTX__IO_RADIUS  26.0
+#define GTX__SAVE_SVG   0
+#ifndef GTX__WIDGETS
+#define GTX__WIDGETS    1  // Zero leaves out the widgets, to build the module DSP alone against shim/ ("make dsp")
+#endif
+#define GTX__WIDGET()   // do { std::cout << "Gratrix Module : " << __FUNCTION__ << "();" << std::endl; } while(0);
+
+
+using namespace rack;
+
+
+extern Plugin *plugin;
+
+
+//============================================================================================================
+//! \brief View onto ports owned by a parent module.
+//!
+//! Holds one pointer per port so a voice can address its slice of the parent's arrays without copying.
+
+template <typename T> struct PortView
+{
+	std::vector<T *> ports;
+
+	explicit PortView(std::size_t size) : ports(size, nullptr) {}
+
+	void bind(std::size_t port, T &that)
+	{
+		ports[port] = &that;
+	}
+
+	T &operator[](std::size_t port) const
+	{
+		return *ports[port];
+	}
+
+	std::size_t size() const
+	{
+		return ports.size();
+	}
+};
+
+
+//============================================================================================================
+//! \brief Where each voice of a bank reads its inputs from.
+//!
+//! A voice reads its own port when that is patched and the bank's N+1 bus port otherwise.  Rack raises no
+//! event when cables come and go, so update() polls the 'active' flags of the voice ports every step and
+//! only re-resolves the table when one of them has changed; lookups are then a single load with no branch.
+
+template <std::size_t N, std::size_t P> struct RouteTable
+{
+	std::array<std::array<Input *, N>, P> source;   // [port][voice]
+	std::array<std::array<bool,    N>, P> patched;  // [port][voice], as of the last rebuild
+	bool valid = false;
+
+	//! \brief Tracks the bus ports [first, last) of 'parent', true when the table was rebuilt.
+	template <typename TBank> bool update(TBank &parent, std::size_t first = 0, std::size_t last = P)
+	{
+		bool changed = !valid;
+
+		for (std::size_t p=first; p<last; ++p)
+		{
+			for (std::size_t i=0; i<N; ++i)
+			{
+				bool active = parent.inputs[TBank::imap(p, i)].active;
+
+				changed |= (active != patched[p][i]);
+				patched[p][i] = active;
+			}
+		}
+
+		if (!changed) return false;
+
+		for (std::size_t p=first; p<last; ++p)
+		{
+			for (std::size_t i=0; i<N; ++i)
+			{
+				source[p][i] = &parent.inputs[TBank::imap(p, patched[p][i] ? i : N)];
+			}
+		}
+
+		valid = true;
+		return true;
+	}
+
+	Input &operator()(std::size_t port, std::size_t voice) const
+	{
+		return *source[port][voice];
+	}
+};
+
+
+//============================================================================================================
+//! \brief One voice of a bank, addressing the bank's ports through views.
+
+struct MicroModule
+{
+	PortView<Param>  params;
+	PortView<Input>  inputs;
+	PortView<Output> outputs;
+	PortView<Light>  lights;
+
+	MicroModule(int numParams, int numInputs, int numOutputs, int numLights = 0)
+	:
+		params(numParams),
+		inputs(numInputs),
+		outputs(numOutputs),
+		lights(numLights)
+	{}
+
+	//! \brief Binds the views of voice 'bank' to its own ports, the parent's port arrays never move once it
+	//! is constructed.
+	template <typename TBank> void bind(TBank &parent, std::size_t bank)
+	{
+		for (std::size_t p=0; p<params.size();  ++p) params .bind(p, parent.params[p]);
+		for (std::size_t p=0; p<inputs.size();  ++p) inputs .bind(p, parent.inputs[TBank::imap(p, bank)]);
+		for (std::size_t p=0; p<outputs.size(); ++p) outputs.bind(p, parent.outputs[TBank::omap(p, bank)]);
+	}
+
+	//! \brief Points the inputs of voice 'bank' at the sources resolved by the bank's routing table.
+	template <std::size_t N, std::size_t P> void route(const RouteTable<N, P> &routes, std::size_t bank)
+	{
+		for (std::size_t p=0; p<inputs.size(); ++p)
+		{
+			inputs.bind(p, routes(p, bank));
+		}
+	}
+};
+
+
+//============================================================================================================
+//! \name Voice lanes
+//!
+//! Banks keep their DSP state structure-of-arrays, one float per voice padded out to simd_lanes(N) lanes, so
+//! the step kernels are plain loops over whole SSE registers that the compiler vectorises across all voices.
+//! The padding lanes run on zero inputs and are never written to a port.
+
+//! \brief Lanes needed for n voices, padded to whole registers.
+constexpr std::size_t simd_lanes(std::size_t n)
+{
+	return (n + GTX__SIMD - 1) / GTX__SIMD * GTX__SIMD;
+}
+
+//! \brief Loads input 'port' of every voice into lanes.
+template <typename TVoice, std::size_t N> inline void gather(float *lanes, const std::array<TVoice, N> &inst, std::size_t port)
+{
+	for (std::size_t k=0; k<N; ++k) lanes[k] = inst[k].inputs[port].value;
+}
+
+//! \brief Loads whether input 'port' of every voice is patched (directly or via the bus) into lanes.
+template <typename TVoice, std::size_t N> inline void gather_active(bool *lanes, const std::array<TVoice, N> &inst, std::size_t port)
+{
+	for (std::size_t k=0; k<N; ++k) lanes[k] = inst[k].inputs[port].active;
+}
+
+//! \brief Stores lanes to output 'port' of every voice.
+template <typename TVoice, std::size_t N> inline void scatter(std::array<TVoice, N> &inst, std::size_t port, const float *lanes)
+{
+	for (std::size_t k=0; k<N; ++k) inst[k].outputs[port].value = lanes[k];
+}
+
+//! \brief How many voices a module runs, N for a bank and GTX__N for the rest, for tools that report figures
+//! per voice.  rack::Module has nowhere to say so, so modules derive from Voices<N> and tools dynamic_cast.
+
+struct VoiceCount
+{
+	std::size_t voice_count;
+};
+
+template <std::size_t N> struct Voices : VoiceCount
+{
+	Voices() : VoiceCount{N} {}
+};
+
+//! \brief Which voices of a bank are in use.
+//!
+//! A voice is idle while none of its own inputs or outputs and none of the bus inputs are patched; ports
+//! shared by every voice do not count.  Banks skip idle voices in their per-voice loops and run their lane
+//! kernels over the first 'lanes' lanes only, the whole registers up to the last voice in use.  Like
+//! RouteTable, update() polls the 'active' flags and only recomputes the mask when they change.
+
+template <std::size_t N, std::size_t NUM_INPUTS, std::size_t NUM_OUTPUTS>
+struct VoiceMask
+{
+	static_assert(N <= 32, "one bit per voice");
+
+	std::uint32_t bits  = 0;
+	std::size_t   lanes = 0;
+	bool          valid = false;
+
+	//! \brief Polls the ports of 'parent', true when the mask changed.
+	template <typename TBank> bool update(const TBank &parent)
+	{
+		bool bus = false;
+
+		for (std::size_t p=0; p<NUM_INPUTS; ++p)
+		{
+			if (TBank::imap(p, 0) != TBank::imap(p, N)) bus |= parent.inputs[TBank::imap(p, N)].active;
+		}
+
+		std::uint32_t used = 0;
+
+		for (std::size_t i=0; i<N; ++i)
+		{
+			bool active = bus;
+
+			for (std::size_t p=0; p<NUM_INPUTS; ++p)
+			{
+				if (TBank::imap(p, 0) != TBank::imap(p, N)) active |= parent.inputs[TBank::imap(p, i)].active;
+			}
+
+			for (std::size_t p=0; p<NUM_OUTPUTS; ++p)
+			{
+				if (TBank::omap(p, 0) != TBank::omap(p, 1)) active |= parent.outputs[TBank::omap(p, i)].active;
+			}
+
+			used |= static_cast<std::uint32_t>(active) << i;
+		}
+
+		if (valid && used == bits) return false;
+
+		std::size_t last = 0;
+
+		for (std::size_t i=0; i<N; ++i)
+		{
+			if (used & (1u << i)) last = i + 1;
+		}
+
+		bits  = used;
+		lanes = simd_lanes(last);
+		valid = true;
+
+		return true;
+	}
+
+	bool operator[](std::size_t voice) const
+	{
+		return (bits >> voice) & 1u;
+	}
+};
+
+
+//============================================================================================================
+//! \brief Treats denormals as zero, and flushes results that would be denormal, for as long as it is in scope.
+//!
+//! Filter and envelope state decaying through silence ends up subnormal, which x86 handles in microcode at
+//! a hundred times the cost of a normal float.  Banks make one around their DSP, and voice threads for
+//! their life.  MXCSR is only written when FTZ or DAZ is missing, and then put back as it was, so the host's
+//! float mode is never changed under it; a host that already runs with FTZ/DAZ pays nothing.
+
+struct DenormalGuard
+{
+#if defined(__SSE__)
+	unsigned int saved;
+
+	DenormalGuard() : saved(_mm_getcsr())
+	{
+		if ((saved & 0x8040) != 0x8040) _mm_setcsr(saved | 0x8040);  // FTZ and DAZ
+	}
+
+	~DenormalGuard()
+	{
+		if ((saved & 0x8040) != 0x8040) _mm_setcsr(saved);
+	}
+
+	DenormalGuard(const DenormalGuard &) = delete;
+	DenormalGuard &operator=(const DenormalGuard &) = delete;
+#endif
+};
+
+//! \brief Zero when below 'threshold' (-400 dB by default), for decaying state that must not go subnormal.
+//!
+//! Only needed where DenormalGuard cannot reach, builds without SSE; with it the DSP runs under a guard
+//! and this is a no-op.
+inline float flush(float x, float threshold = 1e-20f)
+{
+#if defined(__SSE__)
+	return x;
+#else
+	return (x > -threshold && x < threshold) ? 0.0f : x;
+#endif
+}
+
+
+//============================================================================================================
+//! \brief A module's own random number generator, xoshiro128** run as GTX__SIMD interleaved streams.
+//!
+//! Every module draws from its own state rather than Rack's global generator, so modules share nothing
+//! and a run repeats exactly once its seeds are fixed.  Numbers are made a batch at a time in a loop over
+//! the streams that vectorises (the multiplies are shifts and adds), then handed out one by one.
+//! New generators take successive seeds from sequence(), which starts from Rack's generator; tools that
+//! need repeatable renders set it before creating modules, or seed() each module directly.
+
+struct Random
+{
+	static constexpr std::size_t BATCH = 16 * GTX__SIMD;
+
+	alignas(16) std::uint32_t state[4][GTX__SIMD];
+	alignas(16) std::uint32_t batch[BATCH];
+	std::size_t next;
+	float       spare;      // Second value of the last Box-Muller pair
+	bool        haveSpare;
+
+	//! \brief The seed the next generator is created with.
+	static std::uint64_t &sequence()
+	{
+		static std::uint64_t next = (static_cast<std::uint64_t>(randomu32()) << 32) | randomu32();
+		return next;
+	}
+
+	Random()
+	{
+		seed(sequence()++);
+	}
+
+	//! \brief Restarts every stream from 'value', expanded with splitmix64.
+	void seed(std::uint64_t value)
+	{
+		for (std::size_t w=0; w<4; ++w)
+		{
+			for (std::size_t k=0; k<GTX__SIMD; k+=2)
+			{
+				std::uint64_t z = (value += 0x9E3779B97F4A7C15ull);
+				z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+				z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+				z =  z ^ (z >> 31);
+
+				state[w][k  ] = static_cast<std::uint32_t>(z);
+				state[w][k+1] = static_cast<std::uint32_t>(z >> 32);
+			}
+		}
+
+		next = BATCH;
+		haveSpare = false;
+	}
+
+	//! \brief Refills the batch, one step of every stream per GTX__SIMD numbers.
+	void fill()
+	{
+		for (std::size_t b=0; b<BATCH; b+=GTX__SIMD)
+		{
+			for (std::size_t k=0; k<GTX__SIMD; ++k)
+			{
+				std::uint32_t x = state[1][k] * 5;
+				std::uint32_t t = state[1][k] << 9;
+
+				batch[b + k] = ((x << 7) | (x >> 25)) * 9;
+
+				state[2][k] ^= state[0][k];
+				state[3][k] ^= state[1][k];
+				state[1][k] ^= state[2][k];
+				state[0][k] ^= state[3][k];
+				state[2][k] ^= t;
+				state[3][k]  = (state[3][k] << 11) | (state[3][k] >> 21);
+			}
+		}
+
+		next = 0;
+	}
+
+	std::uint32_t u32()
+	{
+		if (next == BATCH) fill();
+
+		return batch[next++];
+	}
+
+	//! \brief Uniform in [0, 1).
+	float uniform()
+	{
+		return (u32() >> 8) * (1.0f / 16777216.0f);
+	}
+
+	//! \brief Standard normal, Box-Muller a pair at a time.
+	float normal()
+	{
+		if (haveSpare)
+		{
+			haveSpare = false;
+			return spare;
+		}
+
+		float radius = std::sqrt(-2.0f * std::log(1.0f - uniform()));
+		float turn   = uniform();
+
+		spare     = radius * GTX::fastmath::sin2pi(turn);
+		haveSpare = true;
+
+		return radius * GTX::fastmath::sin2pi(turn + 0.25f);
+	}
+};
+
+
+//============================================================================================================
+//! \brief Frames per block of a bank, settable from the UI thread.
+//!
+//! A block of K frames delays a bank's outputs by K-1 samples (1.4 ms for 64 frames at 44.1 kHz), so the
+//! default of one frame keeps the plain per-sample behaviour.  Patch changes, knobs and 'active' flags are
+//! taken once per block.
+
+struct BlockSize
+{
+	std::size_t size    = 1;  // Frames in the block being filled
+	std::size_t request = 1;  // Frames wanted, picked up at the next block boundary
+
+	void resize(std::size_t frames)
+	{
+		if (frames == 1 || frames == 8 || frames == 32 || frames == GTX__BLOCK) request = frames;
+	}
+};
+
+
+//============================================================================================================
+//! \brief Inputs and outputs of a bank buffered as lanes, one block of frames at a time.
+//!
+//! step() pushes the current frame, runs the kernel over the whole block once it fills, and pulls the
+//! frame K-1 samples behind the one just pushed.
+
+template <std::size_t N, std::size_t NUM_INPUTS, std::size_t NUM_OUTPUTS>
+struct Block : BlockSize
+{
+	static constexpr std::size_t L = simd_lanes(N);
+
+	alignas(16) float in [GTX__BLOCK][NUM_INPUTS ][L] = {};
+	alignas(16) float out[GTX__BLOCK][NUM_OUTPUTS][L] = {};
+	std::size_t index = 0;
+
+	//! \brief Gathers every voice input into the next frame, true once the block is full.
+	template <typename TVoice> bool push(const std::array<TVoice, N> &inst)
+	{
+		if (index == 0) apply();
+
+		for (std::size_t p=0; p<NUM_INPUTS; ++p) gather(in[index][p], inst, p);
+
+		if (++index < size) return false;
+
+		index = 0;
+		return true;
+	}
+
+	//! \brief Scatters the oldest frame to every voice output, shared outputs need all lanes set alike.
+	template <typename TVoice> void pull(std::array<TVoice, N> &inst)
+	{
+		for (std::size_t p=0; p<NUM_OUTPUTS; ++p) scatter(inst, p, out[index][p]);
+	}
+
+	//! \brief Switches to the requested block size at a block boundary, dropping what was still buffered.
+	void apply()
+	{
+		if (size != request)
+		{
+			size = request;
+			std::memset(out, 0, sizeof(out));
+		}
+	}
+};
+
+
+
+//! \brief Saves the block size of a bank.
+inline void blockSizeToJson(json_t *rootJ, const BlockSize &block)
+{
+	json_object_set_new(rootJ, "block_size", json_integer((int) block.request));
+}
+
+//! \brief Loads the block size of a bank, patches from before block mode run per sample.
+inline void blockSizeFromJson(json_t *rootJ, BlockSize &block)
+{
+	if (json_t *bsJI = json_object_get(rootJ, "block_size"))
+	{
+		block.resize(json_integer_value(bsJI));
+	}
+}
+
+
+//============================================================================================================
+//! \brief How often a bank works out its CV-derived coefficients, settable from the UI thread.
+//!
+//! The powf() behind cutoffs, gains, rates and pitches is taken once every 'interval' frames and ramped
+//! linearly in between, so a coefficient trails its CV by up to interval frames.  A new bank, and one from a
+//! patch saved before the control rate, works them out every frame as the banks always did, the longer
+//! intervals being opted into from the context menu and saved with the patch.  Patches that modulate at
+//! audio rate (FM, filter sweeps from an oscillator) can turn on 'audio' to work them out every frame
+//! whatever the interval, and banks pass 'modulated' for inputs that are always audio rate, such as a
+//! patched FM input.
+
+struct ControlRate
+{
+	std::size_t interval = 1;      // Frames between coefficient updates
+	bool        audio    = false;  // Audio-rate modulation, update every frame whatever the interval
+	std::size_t phase    = 0;      // Frames left until the next update
+
+	void resize(std::size_t frames)
+	{
+		if (frames == 1 || frames == 4 || frames == 16 || frames == 32) interval = frames;
+	}
+
+	//! \brief Frames until the update after this one.
+	std::size_t frames() const
+	{
+		return audio ? 1 : interval;
+	}
+
+	std::size_t frames(bool modulated) const
+	{
+		return modulated ? 1 : frames();
+	}
+
+	//! \brief Advances one frame, true when the coefficients are due.
+	bool due()
+	{
+		if (phase != 0 && phase < frames())
+		{
+			--phase;
+			return false;
+		}
+
+		phase = frames() - 1;
+		return true;
+	}
+
+	//! \brief Advances one frame, true when the coefficients are due, every frame while 'modulated'.
+	bool due(bool modulated)
+	{
+		return due() || modulated;
+	}
+};
+
+
+//============================================================================================================
+//! \brief Coefficients ramping linearly towards their next control-rate value, one lane each.
+
+template <std::size_t L> struct Ramp
+{
+	alignas(16) float value[L] = {};
+	alignas(16) float delta[L] = {};
+	bool primed = false;
+
+	//! \brief Heads for 'target' over the next 'frames' calls of step(), jumping straight there when frames
+	//! is one or nothing has been set yet.
+	void seek(const float *target, std::size_t frames, std::size_t lanes = L)
+	{
+		if (frames == 1 || !primed)
+		{
+			for (std::size_t k=0; k<lanes; ++k) { value[k] = target[k]; delta[k] = 0.0f; }
+			primed = true;
+		}
+		else
+		{
+			const float rate = 1.0f / frames;
+
+			for (std::size_t k=0; k<lanes; ++k) delta[k] = (target[k] - value[k]) * rate;
+		}
+	}
+
+	void step(std::size_t lanes = L)
+	{
+		for (std::size_t k=0; k<lanes; ++k) value[k] += delta[k];
+	}
+};
+
+
+
+//! \brief Saves the control rate of a bank.
+inline void controlRateToJson(json_t *rootJ, const ControlRate &rate)
+{
+	json_object_set_new(rootJ, "control_rate", json_integer((int) rate.interval));
+	json_object_set_new(rootJ, "audio_rate", json_boolean(rate.audio));
+}
+
+//! \brief Loads the control rate of a bank, state without one keeps the new bank's every frame.
+//!
+//! Rack 0.6 only calls fromJson() for a module saved with "data", which no bank had before the control
+//! rate, so old patches never get here and it is the defaults in ControlRate that keep them sounding the same.
+inline void controlRateFromJson(json_t *rootJ, ControlRate &rate)
+{
+	if (json_t *crJI = json_object_get(rootJ, "control_rate"))
+	{
+		rate.resize(json_integer_value(crJI));
+	}
+
+	if (json_t *arJB = json_object_get(rootJ, "audio_rate"))
+	{
+		rate.audio = json_is_true(arJB);
+	}
+}
+
+
+//============================================================================================================
+//! \brief Simple cache structure.
+
+template <typename T> struct Cache
+{
+	bool valid;
+	T    value;
+
+	Cache()
+	{
+		reset();
+	}
+
+	void reset()
+	{
+		valid = false;
+	}
+
+	void set(const T &that)
+	{
+		valid = true;
+		value = that;
+	}
+
+	bool test(const T &that)
+	{
+		return valid && value != that;
+	}
+};
+
+
+//============================================================================================================
+//! \brief A value derived from K inputs, worked out again only once one of them has moved by more than the
+//! tolerance since it was last worked out.
+//!
+//! The inputs are compared against those the value was derived from rather than the previous call's, so
+//! slow drifts still land once they add up.  A tolerance of zero recomputes on any change.
+
+template <typename T, std::size_t K> struct Memo
+{
+	float tolerance;
+	float key[K];
+	T     value;
+	bool  valid = false;
+
+	explicit Memo(float tolerance = 0.0f) : tolerance(tolerance) {}
+
+	void reset()
+	{
+		valid = false;
+	}
+
+	//! \brief The value for 'in', calling derive() when it needs working out again.
+	template <typename F> const T &operator()(const std::array<float, K> &in, F derive)
+	{
+		bool moved = !valid;
+
+		for (std::size_t j=0; j<K; ++j) moved |= std::fabs(in[j] - key[j]) > tolerance;
+
+		if (moved)
+		{
+			for (std::size_t j=0; j<K; ++j) key[j] = in[j];
+
+			value = derive();
+			valid = true;
+		}
+
+		return value;
+	}
+};
+
+
+//============================================================================================================
+//! \brief Memo with one lane per voice, each lane worked out again on its own.
+
+template <std::size_t L, std::size_t K> struct MemoLanes
+{
+	float tolerance;
+	alignas(16) float key[K][L];
+	alignas(16) float value[L];
+	bool valid[L] = {};
+
+	explicit MemoLanes(float tolerance = 0.0f) : tolerance(tolerance) {}
+
+	void reset()
+	{
+		std::fill(valid, valid + L, false);
+	}
+
+	//! \brief Brings the first 'lanes' lanes up to date with 'in', calling derive(k) for each lane k that
+	//! needs working out again.
+	template <typename F> const float *operator()(const float *const (&in)[K], std::size_t lanes, F derive)
+	{
+		for (std::size_t k=0; k<lanes; ++k)
+		{
+			bool moved = !valid[k];
+
+			for (std::size_t j=0; j<K; ++j) moved |= std::fabs(in[j][k] - key[j][k]) > tolerance;
+
+			if (moved)
+			{
+				for (std::size_t j=0; j<K; ++j) key[j][k] = in[j][k];
+
+				value[k] = derive(k);
+				valid[k] = true;
+			}
+		}
+
+		return value;
+	}
+};
+
+
+//============================================================================================================
+//! \brief Worker threads a bank hands parts of its voices to, one pool per process.
+//!
+//! Started the first time a bank asks for more than one thread, with up to GTX__THREADS - 1 workers as the
+//! machine has cores for, each pinned to a core of its own on Linux.  run() posts one part to each worker's
+//! mailbox, a single-slot lock-free queue, does the first part itself, then takes back any part a worker has
+//! not picked up yet, so a sleeping worker or a busy core never leaves the audio thread waiting idle.  It
+//! returns once every part is done, so outputs are only published once the whole bank has run.  Only the
+//! audio thread calls run().  Idle workers spin for a while, then yield, then sleep, so the cores are only
+//! kept busy while some bank uses the pool.
+
+struct VoicePool
+{
+	struct Task
+	{
+		void      (*call)(void *, std::size_t);
+		void       *context;
+		std::size_t part;
+	};
+
+	struct alignas(64) Worker  // A cache line each, apart from their neighbours' mailboxes
+	{
+		std::atomic<Task *> mailbox{nullptr};
+		Task task;
+		std::thread thread;
+	};
+
+	Worker workers[GTX__THREADS - 1];
+	std::atomic<std::size_t> started{0};   // Workers running, published once all are made
+	std::atomic<std::size_t> pending{0};   // Parts of the current run not yet done
+	std::atomic<bool>        running{true};
+	std::mutex               mutex;        // Serialises start(), taken off the audio thread only
+
+	static VoicePool &instance()
+	{
+		static VoicePool pool;
+		return pool;
+	}
+
+	~VoicePool()
+	{
+		running = false;
+
+		for (std::size_t w=0; w<started; ++w) workers[w].thread.join();
+	}
+
+	//! \brief Threads run() can spread over, the caller's and the workers'.
+	std::size_t threads() const
+	{
+		return 1 + started.load(std::memory_order_acquire);
+	}
+
+	//! \brief Starts the workers if not already going.
+	void start()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		if (started) return;
+
+		std::size_t cores = std::max(1u, std::thread::hardware_concurrency());
+		std::size_t count = std::min<std::size_t>(GTX__THREADS, cores) - 1;
+
+		for (std::size_t w=0; w<count; ++w)
+		{
+			workers[w].thread = std::thread(&VoicePool::work, this, w);
+
+		#if defined(__linux__)
+			cpu_set_t set;
+			CPU_ZERO(&set);
+			CPU_SET((w + 1) % cores, &set);
+			pthread_setaffinity_np(workers[w].thread.native_handle(), sizeof(set), &set);
+		#endif
+		}
+
+		started.store(count, std::memory_order_release);
+	}
+
+	//! \brief Calls f(part) for every part in [0, parts), spread over the workers, returning once all are done.
+	template <typename F> void run(std::size_t parts, F &f)
+	{
+		parts = std::min(parts, threads());
+
+		auto call = [](void *context, std::size_t part) { (*static_cast<F *>(context))(part); };
+
+		pending.store(parts - 1, std::memory_order_relaxed);
+
+		for (std::size_t p=1; p<parts; ++p)
+		{
+			Worker &worker = workers[p - 1];
+			worker.task = {call, &f, p};
+			worker.mailbox.store(&worker.task, std::memory_order_release);
+		}
+
+		f(0);
+
+		// Whatever no worker has taken yet is quicker done here than waited for
+		for (std::size_t p=1; p<parts; ++p)
+		{
+			if (Task *task = workers[p - 1].mailbox.exchange(nullptr, std::memory_order_acquire))
+			{
+				task->call(task->context, task->part);
+				pending.fetch_sub(1, std::memory_order_release);
+			}
+		}
+
+		while (pending.load(std::memory_order_acquire)) pause();
+	}
+
+	static void pause()
+	{
+	#if defined(__SSE__)
+		_mm_pause();
+	#endif
+	}
+
+	void work(std::size_t w)
+	{
+		DenormalGuard guard;
+
+		Worker &worker = workers[w];
+		std::size_t idle = 0;
+
+		while (running.load(std::memory_order_relaxed))
+		{
+			if (Task *task = worker.mailbox.exchange(nullptr, std::memory_order_acquire))
+			{
+				task->call(task->context, task->part);
+				pending.fetch_sub(1, std::memory_order_release);
+				idle = 0;
+			}
+			else if (++idle < 4096)
+			{
+				pause();
+			}
+			else if (idle < 65536)
+			{
+				std::this_thread::yield();
+			}
+			else
+			{
+				idle = 65536;
+				std::this_thread::sleep_for(std::chrono::microseconds(500));
+			}
+		}
+	}
+};
+
+
+//============================================================================================================
+//! \brief How many threads a bank splits its voices over, settable from the UI thread.
+//!
+//! Set to more than one, a bank runs each SIMD register of voices from state of its own and hands whole
+//! registers, as evenly as they go, to the VoicePool once a block, or runs them all inline while too few
+//! voices are patched to share.  Only the menu moves a bank between its whole-bank state and the registers,
+//! so patching a cable never does, and the one click comes when the count is changed.  Parts keep their
+//! state apart, but the rows of the block's outputs are shared, so parts next to each other can still write
+//! the same cache line there.  Each hand-off costs a few microseconds and a register run alone costs more
+//! per voice than the whole bank in one pass, so splitting pays off only on large banks in block mode that
+//! one core cannot keep up with.
+
+struct VoiceThreads
+{
+	std::atomic<std::size_t> count{1};
+
+	void resize(std::size_t threads)
+	{
+		if (threads == 1 || threads == 2 || threads == 4)
+		{
+			if (threads > 1) VoicePool::instance().start();
+			count = threads;
+		}
+	}
+
+	//! \brief Whether the bank runs from the state of each register rather than of the whole bank.
+	bool split() const
+	{
+		return count.load(std::memory_order_relaxed) > 1;
+	}
+
+	//! \brief Calls f(first, last) over the registers of the first 'lanes' lanes, in parts run side by side.
+	template <typename F> void run(std::size_t lanes, F f)
+	{
+		std::size_t registers = lanes / GTX__SIMD;
+		std::size_t parts     = std::min({count.load(std::memory_order_relaxed), registers, VoicePool::instance().threads()});
+
+		auto part = [&](std::size_t p) { f(p * registers / parts, (p + 1) * registers / parts); };
+
+		VoicePool::instance().run(parts, part);
+	}
+};
+
+
+
+//! \brief Saves the voice threads of a bank.
+inline void voiceThreadsToJson(json_t *rootJ, const VoiceThreads &threads)
+{
+	json_object_set_new(rootJ, "voice_threads", json_integer((int) threads.count.load()));
+}
+
+//! \brief Loads the voice threads of a bank, patches from before voice threads run on one.
+inline void voiceThreadsFromJson(json_t *rootJ, VoiceThreads &threads)
+{
+	if (json_t *vtJI = json_object_get(rootJ, "voice_threads"))
+	{
+		threads.resize(json_integer_value(vtJI));
+	}
+}
+
+
+//============================================================================================================
+//! \brief The latest copy of T the audio thread published, for the UI thread to draw from, triple buffered.
+//!
+//! The audio thread fills back() and publish()es it, the UI thread reads latest(), whole copies from one
+//! instant each.  Of the three slots each side holds one and the third passes between them by an atomic
+//! exchange, so neither ever waits on the other and no slot is written while it is read.  A UI frame that
+//! comes before the next publish draws the same copy again.  due() paces the copying to GTX__FPS, so the
+//! audio thread pays for a few copies a second rather than one every step.  The sides can as well be swapped,
+//! for the UI thread to hand the audio thread a copy, so long as each side has one thread at a time.
+
+template <typename T> struct Snapshot
+{
+	static constexpr unsigned FRESH = 4;  // Set in 'middle' until the UI thread takes the slot
+
+	unsigned front_ = 2;  // UI thread's slot, the slots between it and the audio thread's side
+	T slots[3] = {};
+	std::atomic<unsigned> middle{1};
+	unsigned back_  = 0;   // Audio thread's slot
+	std::size_t wait = 0;  // Frames until due
+
+	//! \brief True once every 1/GTX__FPS seconds of frames, when the audio thread should publish.
+	bool due()
+	{
+		if (wait) { --wait; return false; }
+
+		wait = static_cast<std::size_t>(engineGetSampleRate() / GTX__FPS);
+		return true;
+	}
+
+	//! \brief The slot the audio thread fills, left as it was two publishes ago.
+	T &back() { return slots[back_]; }
+
+	void publish()
+	{
+		back_ = middle.exchange(back_ | FRESH, std::memory_order_acq_rel) & 3;
+	}
+
+	//! \brief The copy published last, which stays as it is until the next call.
+	const T &latest()
+	{
+		if (middle.load(std::memory_order_relaxed) & FRESH)
+		{
+			front_ = middle.exchange(front_, std::memory_order_acq_rel) & 3;
+		}
+
+		return slots[front_];
+	}
+};
+
+
+//============================================================================================================
+//! \brief Single producer, single consumer ring of step() begin and end times.
+//!
+//! The audio thread pushes and the tracer's thread pops, neither waits.  When the tracer falls behind the
+//! newest events are dropped and counted rather than blocking the audio thread.
+
+struct TraceRing
+{
+	static constexpr std::size_t SIZE = 4096;  // Power of two, 20 ms of steps at 192 kHz
+
+	struct Event
+	{
+		std::uint64_t begin;
+		std::uint64_t end;
+	};
+
+	Event events[SIZE];
+	std::atomic<std::size_t> head{0};     // Next to push, written by the audio thread
+	std::atomic<std::size_t> tail{0};     // Next to pop, written by the tracer
+	std::atomic<std::size_t> dropped{0};
+
+	void push(std::uint64_t begin, std::uint64_t end)
+	{
+		std::size_t h = head.load(std::memory_order_relaxed);
+
+		if (h - tail.load(std::memory_order_acquire) == SIZE)
+		{
+			dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		events[h & (SIZE - 1)] = {begin, end};
+		head.store(h + 1, std::memory_order_release);
+	}
+
+	bool pop(Event &event)
+	{
+		std::size_t t = tail.load(std::memory_order_relaxed);
+
+		if (t == head.load(std::memory_order_acquire)) return false;
+
+		event = events[t & (SIZE - 1)];
+		tail.store(t + 1, std::memory_order_release);
+		return true;
+	}
+};
+
+
+//============================================================================================================
+//! \brief Cost of a module's step(), off until enabled from the context menu.
+//!
+//! Counts time-stamp counter cycles where there is one, nanoseconds otherwise.  Steps go into a histogram
+//! with four bins per octave so the p99 comes out to within 25% at any time without keeping samples.  The
+//! audio thread writes and the UI thread reads without locking, a figure read mid-step is only stale.
+//! While the Tracer runs every step also goes to the module's TraceRing, made on first use then kept.
+
+struct StepProfile
+{
+	static constexpr std::size_t BINS = 128;  // Four per octave up to 2^32
+
+	std::atomic<bool> enabled{false};  // Toggled from the UI thread, read by the audio thread
+	std::uint64_t     count   = 0;
+	std::uint64_t     total   = 0;
+	std::uint64_t     peak    = 0;
+	std::uint32_t     bins[BINS] = {};
+
+	const Module *owner;
+	std::atomic<TraceRing *> ring{nullptr};
+
+	explicit StepProfile(const Module *owner);
+	~StepProfile();
+
+	static std::uint64_t now()
+	{
+	#if defined(__SSE__)
+		return __rdtsc();
+	#else
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	#endif
+	}
+
+	static const char *unit()
+	{
+	#if defined(__SSE__)
+		return "cycles";
+	#else
+		return "ns";
+	#endif
+	}
+
+	//! \brief Bin of 'ticks', the octave and the next two bits below its leading one.
+	static std::size_t bin(std::uint64_t ticks)
+	{
+		if (ticks < 4) return static_cast<std::size_t>(ticks);
+
+		std::size_t octave = 63 - __builtin_clzll(ticks);
+		std::size_t index  = 4 * octave + ((ticks >> (octave - 2)) & 3) - 4;
+
+		return std::min(index, BINS - 1);
+	}
+
+	//! \brief Upper edge of bin 'index'.
+	static std::uint64_t edge(std::size_t index)
+	{
+		if (index < 4) return index;
+
+		std::size_t octave = (index + 4) / 4;
+		return (std::uint64_t(4 + (index + 4) % 4 + 1) << (octave - 2)) - 1;
+	}
+
+	void reset()
+	{
+		count = total = peak = 0;
+		std::fill(bins, bins + BINS, 0);
+	}
+
+	void add(std::uint64_t ticks)
+	{
+		++count;
+		total += ticks;
+		peak   = std::max(peak, ticks);
+		++bins[bin(ticks)];
+	}
+
+	std::uint64_t mean() const
+	{
+		return count ? total / count : 0;
+	}
+
+	//! \brief Ticks that a fraction 'q' of steps came in under, rounded up to the edge of a bin.
+	std::uint64_t percentile(double q) const
+	{
+		std::uint64_t target = static_cast<std::uint64_t>(std::ceil(q * count));
+		std::uint64_t seen   = 0;
+
+		for (std::size_t i=0; i<BINS; ++i)
+		{
+			seen += bins[i];
+			if (seen >= target && seen) return std::min(edge(i), peak);
+		}
+
+		return peak;
+	}
+};
+
+
+
+//============================================================================================================
+//! \brief Writes the steps of every module to a Chrome trace file, for chrome://tracing or Perfetto.
+//!
+//! One per process, started and stopped from any module's context menu.  A background thread drains each
+//! module's ring every few milliseconds into "X" events, one track per module named after its type, so the
+//! audio thread never touches the file.  Time-stamp ticks become microseconds through a calibration the
+//! thread makes against steady_clock before tracing begins.  The file is opened before the thread is made, so
+//! a trace that cannot be written never starts, and a finished thread is always joined before the next.
+
+struct Tracer
+{
+	std::mutex mutex;                      // Guards profiles, taken off the audio thread only
+	std::vector<StepProfile *> profiles;
+	std::atomic<bool> active{false};
+	std::atomic<bool> running{false};
+	std::thread worker;
+	std::string path;
+
+	static Tracer &instance()
+	{
+		static Tracer tracer;
+		return tracer;
+	}
+
+	static bool tracing()
+	{
+		return instance().active.load(std::memory_order_relaxed);
+	}
+
+	~Tracer()
+	{
+		stop();
+	}
+
+	void attach(StepProfile *profile)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		profiles.push_back(profile);
+		if (running) profile->ring.store(new TraceRing(), std::memory_order_release);
+	}
+
+	void detach(StepProfile *profile)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		profiles.erase(std::remove(profiles.begin(), profiles.end(), profile), profiles.end());
+	}
+
+	//! \brief Starts tracing to 'file', false if it cannot be opened.
+	bool start(const std::string &file)
+	{
+		if (running) return true;
+		if (worker.joinable()) worker.join();
+
+		std::FILE *out = std::fopen(file.c_str(), "w");
+		if (!out) return false;
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			for (StepProfile *profile : profiles)
+			{
+				if (!profile->ring.load()) profile->ring.store(new TraceRing(), std::memory_order_release);
+			}
+		}
+
+		path    = file;
+		running = true;
+		worker  = std::thread(&Tracer::run, this, out);
+		return true;
+	}
+
+	void stop()
+	{
+		running = false;
+		if (worker.joinable()) worker.join();
+	}
+
+	static std::string name(const Module *owner)
+	{
+		const char *mangled = typeid(*owner).name();
+		int status = 0;
+		char *demangled = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
+		std::string result = status == 0 ? demangled : mangled;
+		std::free(demangled);
+		return result;
+	}
+
+	void run(std::FILE *file)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		std::uint64_t tick0  = StepProfile::now();
+		Clock::time_point t0 = Clock::now();
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		double usPerTick = std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / (StepProfile::now() - tick0);
+
+		std::fprintf(file, "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n");
+		std::fprintf(file, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"args\": {\"name\": \"Gratrix\"}}");
+
+		std::vector<const StepProfile *> named;
+		std::vector<std::size_t>         dropped;
+
+		active = true;
+
+		for (bool last = false; !last; )
+		{
+			last = !running;
+			if (!last) std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+			std::lock_guard<std::mutex> lock(mutex);
+
+			for (StepProfile *profile : profiles)
+			{
+				TraceRing *ring = profile->ring.load(std::memory_order_acquire);
+				TraceRing::Event event;
+
+				if (!ring || !ring->pop(event)) continue;
+
+				// Named at its first step, when the module is sure to be fully made
+				std::size_t tid = std::find(named.begin(), named.end(), profile) - named.begin();
+
+				if (tid == named.size())
+				{
+					named.push_back(profile);
+					dropped.push_back(ring->dropped.load());
+					std::fprintf(file, ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %zu, \"args\": {\"name\": \"%s\"}}",
+						tid, name(profile->owner).c_str());
+				}
+
+				do
+				{
+					if (event.begin < tick0) continue;  // Left from an earlier trace
+
+					std::fprintf(file, ",\n{\"name\": \"step\", \"ph\": \"X\", \"pid\": 1, \"tid\": %zu, \"ts\": %.3f, \"dur\": %.3f}",
+						tid, (event.begin - tick0) * usPerTick, (event.end - event.begin) * usPerTick);
+				}
+				while (ring->pop(event));
+
+				std::size_t lost = ring->dropped.load();
+
+				if (lost != dropped[tid])
+				{
+					std::fprintf(file, ",\n{\"name\": \"dropped %zu\", \"ph\": \"i\", \"s\": \"t\", \"pid\": 1, \"tid\": %zu, \"ts\": %.3f}",
+						lost - dropped[tid], tid, (StepProfile::now() - tick0) * usPerTick);
+					dropped[tid] = lost;
+				}
+			}
+
+			if (!running) active = false;
+		}
+
+		std::fprintf(file, "\n]}\n");
+		std::fclose(file);
+	}
+};
+
+inline StepProfile::StepProfile(const Module *owner) : owner(owner)
+{
+	Tracer::instance().attach(this);
+}
+
+inline StepProfile::~StepProfile()
+{
+	Tracer::instance().detach(this);
+	delete ring.load();
+}
+
+
+//============================================================================================================
+//! \brief Times one step() into a StepProfile, and into the trace while one runs.
+
+struct StepTimer
+{
+	StepProfile  &profile;
+	bool          on;
+	std::uint64_t start;
+
+	explicit StepTimer(StepProfile &profile)
+	:
+		profile(profile),
+		on(profile.enabled.load(std::memory_order_relaxed) || Tracer::tracing()),
+		start(on ? StepProfile::now() : 0)
+	{}
+
+	~StepTimer()
+	{
+		if (!on) return;
+
+		std::uint64_t end = StepProfile::now();
+
+		if (profile.enabled.load(std::memory_order_relaxed)) profile.add(end - start);
+
+		if (Tracer::tracing())
+		{
+			if (TraceRing *ring = profile.ring.load(std::memory_order_acquire)) ring->push(start, end);
+		}
+	}
+};
+
+
+#endif
@@ -0,0 +1,535 @@
+#ifndef GTX__GRATRIX_WIDGETS_HPP
+#define GTX__GRATRIX_WIDGETS_HPP
+
+
+//============================================================================================================
+//! \brief The part of Gratrix.hpp the module widgets need: context menus, port and knob components, layout.
+
+#include "GratrixDsp.hpp"
+
+
+//============================================================================================================
+//! \brief Context menu entries picking a bank's block size.
+
+struct BlockSizeItem : MenuItem
+{
+	BlockSize  *block;
+	std::size_t frames;
+
+	void onAction(EventAction &e) override
+	{
+		block->resize(frames);
+	}
+
+	void step() override
+	{
+		rightText = CHECKMARK(block->request == frames);
+		MenuItem::step();
+	}
+};
+
+inline void appendBlockSizeMenu(Menu *menu, BlockSize &block)
+{
+	menu->addChild(MenuEntry::create());
+	menu->addChild(MenuLabel::create("Block size (latency)"));
+
+	static const char *labels[] = {"1 (none)", "8 (7 samples)", "32 (31 samples)", "64 (63 samples)"};
+	static const std::size_t frames[] = {1, 8, 32, GTX__BLOCK};
+
+	for (std::size_t i=0; i<4; ++i)
+	{
+		BlockSizeItem *item = MenuItem::create<BlockSizeItem>(labels[i]);
+		item->block  = &block;
+		item->frames = frames[i];
+		menu->addChild(item);
+	}
+}
+
+
+//============================================================================================================
+//! \brief Context menu entries picking a bank's control rate.
+
+struct ControlRateItem : MenuItem
+{
+	ControlRate *rate;
+	std::size_t  frames;
+
+	void onAction(EventAction &e) override
+	{
+		rate->resize(frames);
+	}
+
+	void step() override
+	{
+		rightText = CHECKMARK(rate->interval == frames);
+		MenuItem::step();
+	}
+};
+
+struct AudioRateItem : MenuItem
+{
+	ControlRate *rate;
+
+	void onAction(EventAction &e) override
+	{
+		rate->audio = !rate->audio;
+	}
+
+	void step() override
+	{
+		rightText = CHECKMARK(rate->audio);
+		MenuItem::step();
+	}
+};
+
+inline void appendControlRateMenu(Menu *menu, ControlRate &rate)
+{
+	menu->addChild(MenuEntry::create());
+	menu->addChild(MenuLabel::create("Control rate"));
+
+	static const char *labels[] = {"Every sample", "Every 4 samples", "Every 16 samples", "Every 32 samples"};
+	static const std::size_t frames[] = {1, 4, 16, 32};
+
+	for (std::size_t i=0; i<4; ++i)
+	{
+		ControlRateItem *item = MenuItem::create<ControlRateItem>(labels[i]);
+		item->rate   = &rate;
+		item->frames = frames[i];
+		menu->addChild(item);
+	}
+
+	AudioRateItem *item = MenuItem::create<AudioRateItem>("Audio-rate modulation");
+	item->rate = &rate;
+	menu->addChild(item);
+}
+
+
+//============================================================================================================
+//! \brief Context menu entries picking how many threads a bank splits its voices over.
+
+struct VoiceThreadsItem : MenuItem
+{
+	VoiceThreads *threads;
+	std::size_t   count;
+
+	void onAction(EventAction &e) override
+	{
+		threads->resize(count);
+	}
+
+	void step() override
+	{
+		rightText = CHECKMARK(threads->count == count);
+		MenuItem::step();
+	}
+};
+
+inline void appendVoiceThreadsMenu(Menu *menu, VoiceThreads &threads)
+{
+	menu->addChild(MenuEntry::create());
+	menu->addChild(MenuLabel::create("Voice threads (use with blocks)"));
+
+	static const char *labels[] = {"1 (audio thread only)", "2", "4"};
+	static const std::size_t counts[] = {1, 2, 4};
+
+	for (std::size_t i=0; i<3; ++i)
+	{
+		VoiceThreadsItem *item = MenuItem::create<VoiceThreadsItem>(labels[i]);
+		item->threads = &threads;
+		item->count   = counts[i];
+		menu->addChild(item);
+	}
+}
+
+
+//============================================================================================================
+//! \brief Context menu entries showing a module's step() cost.
+
+struct ProfileItem : MenuItem
+{
+	StepProfile *profile;
+
+	void onAction(EventAction &e) override
+	{
+		profile->reset();
+		profile->enabled = !profile->enabled;
+	}
+
+	void step() override
+	{
+		rightText = CHECKMARK(profile->enabled);
+		MenuItem::step();
+	}
+};
+
+struct ProfileResetItem : MenuItem
+{
+	StepProfile *profile;
+
+	void onAction(EventAction &e) override
+	{
+		profile->reset();
+	}
+};
+
+//! \brief Starts and stops the Tracer, for every module at once.
+struct TraceItem : MenuItem
+{
+	void onAction(EventAction &e) override
+	{
+		Tracer &tracer = Tracer::instance();
+
+		if (tracer.running) tracer.stop();
+		else                tracer.start(assetLocal("Gratrix-trace.json"));
+	}
+
+	void step() override
+	{
+		rightText = CHECKMARK(Tracer::instance().running);
+		MenuItem::step();
+	}
+};
+
+inline void appendProfileMenu(Menu *menu, StepProfile &profile)
+{
+	menu->addChild(MenuEntry::create());
+	menu->addChild(MenuLabel::create("CPU per step"));
+
+	ProfileItem *item = MenuItem::create<ProfileItem>("Profile");
+	item->profile = &profile;
+	menu->addChild(item);
+
+	if (profile.enabled && profile.count)
+	{
+		char text[64];
+
+		std::snprintf(text, sizeof(text), "Mean %llu %s", (unsigned long long) profile.mean(), StepProfile::unit());
+		menu->addChild(MenuLabel::create(text));
+		std::snprintf(text, sizeof(text), "p99 %llu %s", (unsigned long long) profile.percentile(0.99), StepProfile::unit());
+		menu->addChild(MenuLabel::create(text));
+		std::snprintf(text, sizeof(text), "Max %llu %s", (unsigned long long) profile.peak, StepProfile::unit());
+		menu->addChild(MenuLabel::create(text));
+
+		ProfileResetItem *reset = MenuItem::create<ProfileResetItem>("Reset", std::to_string(profile.count) + " steps");
+		reset->profile = &profile;
+		menu->addChild(reset);
+	}
+
+	menu->addChild(MenuItem::create<TraceItem>("Trace all modules"));
+
+	if (Tracer::instance().running)
+	{
+		menu->addChild(MenuLabel::create(Tracer::instance().path));
+	}
+}
+
+
+//============================================================================================================
+//! \name UI Port components
+
+struct PortInMed : SVGPort
+{
+	PortInMed()
+	{
+		background->svg = SVG::load(assetPlugin(plugin, "res/components/PortInMedium.svg"));
+		background->wrap();
+		box.size = background->box.size;
+	}
+
+	static Vec size() { return Vec(25.0, 25.0); }  // Copied from SVG so no need to pre-load.
+	static Vec pos()  { return Vec(12.5, 12.5); }  // Copied from SVG so no need to pre-load.
+};
+
+struct PortOutMed : SVGPort
+{
+	PortOutMed()
+	{
+		background->svg = SVG::load(assetPlugin(plugin, "res/components/PortOutMedium.svg"));
+		background->wrap();
+		box.size = background->box.size;
+	}
+
+	static Vec size() { return Vec(25.0, 25.0); }  // Copied from SVG so no need to pre-load.
+	static Vec pos()  { return Vec(12.5, 12.5); }  // Copied from SVG so no need to pre-load.
+};
+
+struct PortInSml : SVGPort
+{
+	PortInSml()
+	{
+		background->svg = SVG::load(assetPlugin(plugin, "res/components/PortInSmall.svg"));
+		background->wrap();
+		box.size = background->box.size;
+	}
+
+	static Vec size() { return Vec(18, 18); }  // Copied from SVG so no need to pre-load.
+	static Vec pos()  { return Vec( 9,  9); }  // Copied from SVG so no need to pre-load.
+};
+
+struct PortOutSml : SVGPort
+{
+	PortOutSml()
+	{
+		background->svg = SVG::load(assetPlugin(plugin, "res/components/PortOutSmall.svg"));
+		background->wrap();
+		box.size = background->box.size;
+	}
+
+	static Vec size() { return Vec(18, 18); }  // Copied from SVG so no need to pre-load.
+	static Vec pos()  { return Vec( 9,  9); }  // Copied from SVG so no need to pre-load.
+};
+
+struct PortInTny : SVGPort
+{
+	PortInTny()
+	{
+		background->svg = SVG::load(assetPlugin(plugin, "res/components/PortInTiny.svg"));
+		background->wrap();
+		box.size = background->box.size;
+	}
+
+	static Vec size() { return Vec(14, 14); }  // Copied from SVG so no need to pre-load.
+	static Vec pos()  { return Vec( 7,  7); }  // Copied from SVG so no need to pre-load.
+};
+
+struct PortOutTny : SVGPort
+{
+	PortOutTny()
+	{
+		background->svg = SVG::load(assetPlugin(plugin, "res/components/PortOutTiny.svg"));
+		background->wrap();
+		box.size = background->box.size;
+	}
+
+	static Vec size() { return Vec(14, 14); }  // Copied from SVG so no need to pre-load.
+	static Vec pos()  { return Vec( 7,  7); }  // Copied from SVG so no need to pre-load.
+};
+
+
+//============================================================================================================
+//! \name UI Knob components
+
+struct KnobFreeHug : RoundKnob
+{
+	KnobFreeHug()
+	{
+		setSVG(SVG::load(assetPlugin(plugin, "res/components/KnobFreeHuge.svg")));
+		box.size = Vec(56, 56);
+	}
+
+	static Vec size() { return Vec(56.0, 56.0); }  // Copied from SVG so no need to pre-load.
+	static Vec pos()  { return Vec(28.0, 28.0); }  // Copied from SVG so no need to pre-load.
+};
+
+struct KnobSnapHug : RoundKnob
+{
+	KnobSnapHug()
+	{
+		setSVG(SVG::load(assetPlugin(plugin, "res/components/KnobSnapHuge.svg")));
+		box.size = Vec(56, 56);
+		snap = true;
+	}
+
+	static Vec size() { return Vec(56.0, 56.0); }  // Copied from SVG so no need to pre-load.
+	static Vec pos()  { return Vec(28.0, 28.0); }  // Copied from SVG so no need to pre-load.
+};
+
+struct KnobFreeLrg : RoundKnob
+{
+	KnobFreeLrg()
+	{
+		setSVG(SVG::load(assetPlugin(plugin, "res/components/KnobFreeLarge.svg")));
+		box.size = Vec(46, 46);
+	}
+
+	static Vec size() { return Vec(46.0, 46.0); }  // Copied from SVG so no need to pre-load.
+	static Vec pos()  { return Vec(23.0, 23.0); }  // Copied from SVG so no need to pre-load.
+};
+
+struct KnobSnapLrg : RoundKnob
+{
+	KnobSnapLrg()
+	{
+		setSVG(SVG::load(assetPlugin(plugin, "res/components/KnobSnapLarge.svg")));
+		box.size = Vec(46, 46);
+		snap = true;
+	}
+
+	static Vec size() { return Vec(46.0, 46.0); }  // Copied from SVG so no need to pre-load.
+	static Vec pos()  { return Vec(23.0, 23.0); }  // Copied from SVG so no need to pre-load.
+};
+
+struct KnobFreeMed : RoundKnob
+{
+	KnobFreeMed()
+	{
+		setSVG(SVG::load(assetPlugin(plugin, "res/components/KnobFreeMedium.svg")));
+		box.size = Vec(38, 38);
+	}
+
+	static Vec size() { return Vec(38.0, 38.0); }  // Copied from SVG so no need to pre-load.
+	static Vec pos()  { return Vec(19.0, 19.0); }  // Copied from SVG so no need to pre-load.
+};
+
+struct KnobSnapMed : RoundKnob
+{
+	KnobSnapMed()
+	{
+		setSVG(SVG::load(assetPlugin(plugin, "res/components/KnobSnapMedium.svg")));
+		box.size = Vec(38, 38);
+		snap = true;
+	}
+
+	static Vec size() { return Vec(38.0, 38.0); }  // Copied from SVG so no need to pre-load.
+	static Vec pos()  { return Vec(19.0, 19.0); }  // Copied from SVG so no need to pre-load.
+};
+
+struct KnobFreeSml : RoundKnob
+{
+	KnobFreeSml()
+	{
+		setSVG(SVG::load(assetPlugin(plugin, "res/components/KnobFreeSmall.svg")));
+		box.size = Vec(28, 28);
+	}
+
+	static Vec size() { return Vec(28.0, 28.0); }  // Copied from SVG so no need to pre-load.
+	static Vec pos()  { return Vec(14.0, 14.0); }  // Copied from SVG so no need to pre-load.
+};
+
+struct KnobSnapSml : RoundKnob
+{
+	KnobSnapSml()
+	{
+		setSVG(SVG::load(assetPlugin(plugin, "res/components/KnobSnapSmall.svg")));
+		box.size = Vec(28, 28);
+		snap = true;
+	}
+
+	static Vec size() { return Vec(28.0, 28.0); }  // Copied from SVG so no need to pre-load.
+	static Vec pos()  { return Vec(14.0, 14.0); }  // Copied from SVG so no need to pre-load.
+};
+
+struct KnobFreeTny : RoundKnob
+{
+	KnobFreeTny()
+	{
+		setSVG(SVG::load(assetPlugin(plugin, "res/components/KnobFreeTiny.svg")));
+		box.size = Vec(28, 28);
+	}
+
+	static Vec size() { return Vec(28.0, 28.0); }  // Copied from SVG so no need to pre-load.
+	static Vec pos()  { return Vec(14.0, 14.0); }  // Copied from SVG so no need to pre-load.
+};
+
+struct KnobSnapTny : RoundKnob
+{
+	KnobSnapTny()
+	{
+		setSVG(SVG::load(assetPlugin(plugin, "res/components/KnobSnapTiny.svg")));
+		box.size = Vec(28, 28);
+		snap = true;
+	}
+
+	static Vec size() { return Vec(28.0, 28.0); }  // Copied from SVG so no need to pre-load.
+	static Vec pos()  { return Vec(14.0, 14.0); }  // Copied from SVG so no need to pre-load.
+};
+
+
+//============================================================================================================
+//! \brief Voice port components, medium ports only fit six voices around a bus and small ports eight.
+
+template <std::size_t N> using PortInVoice  = typename std::conditional<(N > 8), PortInTny,
+                                              typename std::conditional<(N > 6), PortInSml,  PortInMed >::type>::type;
+template <std::size_t N> using PortOutVoice = typename std::conditional<(N > 8), PortOutTny,
+                                              typename std::conditional<(N > 6), PortOutSml, PortOutMed>::type>::type;
+
+
+//============================================================================================================
+//! \brief Create output function that creates the UI component centered.
+
+template <class TPort> Port *createInputGTX(Vec pos, Module *module, int outputId)
+{
+	return Port::create<TPort>(pos.minus(TPort::pos()), Port::INPUT, module, outputId);
+}
+
+
+//============================================================================================================
+//! \brief Create output function that creates the UI component centered.
+
+template <class TPort> Port *createOutputGTX(Vec pos, Module *module, int outputId)
+{
+	return Port::create<TPort>(pos.minus(TPort::pos()), Port::OUTPUT, module, outputId);
+}
+
+
+//============================================================================================================
+//! \brief Create param function that creates the UI component centered.
+
+template <class TParamWidget> ParamWidget *createParamGTX(Vec pos, Module *module, int paramId, float minValue, float maxValue, float defaultValue)
+{
+	return ParamWidget::create<TParamWidget>(pos.minus(TParamWidget::pos()), module, paramId, minValue, maxValue, defaultValue);
+}
+
+
+//============================================================================================================
+//! \brief ...
+
+inline double dx(double i, std::size_t n) { return  std::sin(GTX__2PI * static_cast<double>(i) / static_cast<double>(n)); }
+inline double dy(double i, std::size_t n) { return -std::cos(GTX__2PI * static_cast<double>(i) / static_cast<double>(n)); }
+inline double dx(double i               ) { return dx(i, GTX__N); }
+inline double dy(double i               ) { return dy(i, GTX__N); }
+
+inline int    gx(double i) { return static_cast<int>(std::floor(0.5 + ((i+0.5) *  90))); }
+inline int    gy(double i) { return static_cast<int>(std::floor(8.5 + ((i+1.0) * 102))); }
+inline int    fx(double i) { return gx(i); }
+inline int    fy(double i) { return gy(i - 0.1); }
+
+inline double rad_n_b() { return 27;    }
+inline double rad_n_m() { return 18;    }
+inline double rad_n_s() { return 14;    }
+inline double rad_l_m() { return  4.75; }
+inline double rad_l_s() { return  3.25; }
+inline double rad_but() { return  9;    }
+inline double rad_scr() { return  8;    }
+inline double rad_prt() { return 12.5;  }
+
+inline Vec    tog(double x, double y) { return Vec(x - 7, y - 10); }
+inline Vec    n_b(double x, double y) { return Vec(x - rad_n_b(), y - rad_n_b()); }
+inline Vec    n_m(double x, double y) { return Vec(x - rad_n_m(), y - rad_n_m()); }
+inline Vec    n_s(double x, double y) { return Vec(x - rad_n_s(), y - rad_n_s()); }
+inline Vec    l_m(double x, double y) { return Vec(x - rad_l_m(), y - rad_l_m()); }
+inline Vec    l_s(double x, double y) { return Vec(x - rad_l_s(), y - rad_l_s()); }
+inline Vec    but(double x, double y) { return Vec(x - rad_but(), y - rad_but()); }
+inline Vec    scr(double x, double y) { return Vec(x - rad_scr(), y - rad_scr()); }
+inline Vec    prt(double x, double y) { return Vec(x - rad_prt(), y - rad_prt()); }
+
+inline Vec    tog(const Vec &a)       { return tog(a.x, a.y); }
+inline Vec    n_b(const Vec &a)       { return n_b(a.x, a.y); }
+inline Vec    n_m(const Vec &a)       { return n_m(a.x, a.y); }
+inline Vec    n_s(const Vec &a)       { return n_s(a.x, a.y); }
+inline Vec    l_m(const Vec &a)       { return l_m(a.x, a.y); }
+inline Vec    l_s(const Vec &a)       { return l_s(a.x, a.y); }
+inline Vec    but(const Vec &a)       { return but(a.x, a.y); }
+inline Vec    scr(const Vec &a)       { return scr(a.x, a.y); }
+inline Vec    prt(const Vec &a)       { return prt(a.x, a.y); }
+
+inline double px(          std::size_t i) { return GTX__IO_RADIUS * dx(i); }
+inline double py(          std::size_t i) { return GTX__IO_RADIUS * dy(i); }
+inline double px(double j, std::size_t i) { return gx(j) + px(i); }
+inline double py(double j, std::size_t i) { return gy(j) + py(i); }
+
+// Voice port i of n around its bus port: one ring of medium ports up to six voices, one ring of small ports
+// up to eight, and beyond that tiny ports with every other one staggered out onto a second ring.  All stay
+// inside the bus circle (radius 40) the panels draw, clear of the label above it.
+inline double rad_io(std::size_t i, std::size_t n) { return (n <= 6) ? GTX__IO_RADIUS : (n <= 8) ? 27.0 : (i % 2) ? 33.0 : 21.0; }
+
+inline double px(double j, std::size_t i, std::size_t n) { return gx(j) + rad_io(i, n) * dx(i, n); }
+inline double py(double j, std::size_t i, std::size_t n) { return gy(j) + rad_io(i, n) * dy(i, n); }
+
+
+#if GTX__SAVE_SVG
+#include "PanelGen.hpp"
+#endif
+
+
+#endif
@@ -17,7 +17,7 @@ namespace Keys_G1 {
 //============================================================================================================
 //! \brief The module.
 
-struct GtxModule : Module
+struct GtxModule : Module, Voices<GTX__N>
 {
 	enum ParamIds {
 		NUM_PARAMS
@@ -66,6 +66,9 @@ struct GtxModule : Module
 		}
 	}
 
+	RouteTable<GTX__N, NUM_INPUTS> routes;  // GATE inputs only
+	StepProfile profile{this};
+
 	GtxModule()
 	:
 		Module(NUM_PARAMS, ((GTX__N+1) * NUM_INPUTS/2) + (GTX__N * NUM_INPUTS/2), NUM_OUTPUTS, NUM_LIGHTS)
@@ -73,22 +76,20 @@ struct GtxModule : Module
 
 	void step() override
 	{
+		StepTimer timer(profile);
+
 		float leds[NUM_LIGHTS] = {};
 
+		routes.update(*this, GATE_1R_INPUT, VOCT_1R_INPUT);
+
 		for (std::size_t i=0; i<GTX__N; ++i)
 		{
-			if (inputs[imap(GATE_1R_INPUT, i)].active) decode(&leds[KEY_LIGHT_1], 0, inputs[imap(GATE_1R_INPUT,      i)], inputs[imap(VOCT_1R_INPUT, i)]);
-			else                                       decode(&leds[KEY_LIGHT_1], 0, inputs[imap(GATE_1R_INPUT, GTX__N)], inputs[imap(VOCT_1R_INPUT, i)]);
-			if (inputs[imap(GATE_1G_INPUT, i)].active) decode(&leds[KEY_LIGHT_1], 1, inputs[imap(GATE_1G_INPUT,      i)], inputs[imap(VOCT_1G_INPUT, i)]);
-			else                                       decode(&leds[KEY_LIGHT_1], 1, inputs[imap(GATE_1G_INPUT, GTX__N)], inputs[imap(VOCT_1G_INPUT, i)]);
-			if (inputs[imap(GATE_1B_INPUT, i)].active) decode(&leds[KEY_LIGHT_1], 2, inputs[imap(GATE_1B_INPUT,      i)], inputs[imap(VOCT_1B_INPUT, i)]);
-			else                                       decode(&leds[KEY_LIGHT_1], 2, inputs[imap(GATE_1B_INPUT, GTX__N)], inputs[imap(VOCT_1B_INPUT, i)]);
-			if (inputs[imap(GATE_2R_INPUT, i)].active) decode(&leds[KEY_LIGHT_2], 0, inputs[imap(GATE_2R_INPUT,      i)], inputs[imap(VOCT_2R_INPUT, i)]);
-			else                                       decode(&leds[KEY_LIGHT_2], 0, inputs[imap(GATE_2R_INPUT, GTX__N)], inputs[imap(VOCT_2R_INPUT, i)]);
-			if (inputs[imap(GATE_2G_INPUT, i)].active) decode(&leds[KEY_LIGHT_2], 1, inputs[imap(GATE_2G_INPUT,      i)], inputs[imap(VOCT_2G_INPUT, i)]);
-			else                                       decode(&leds[KEY_LIGHT_2], 1, inputs[imap(GATE_2G_INPUT, GTX__N)], inputs[imap(VOCT_2G_INPUT, i)]);
-			if (inputs[imap(GATE_2B_INPUT, i)].active) decode(&leds[KEY_LIGHT_2], 2, inputs[imap(GATE_2B_INPUT,      i)], inputs[imap(VOCT_2B_INPUT, i)]);
-			else                                       decode(&leds[KEY_LIGHT_2], 2, inputs[imap(GATE_2B_INPUT, GTX__N)], inputs[imap(VOCT_2B_INPUT, i)]);
+			decode(&leds[KEY_LIGHT_1], 0, routes(GATE_1R_INPUT, i), inputs[imap(VOCT_1R_INPUT, i)]);
+			decode(&leds[KEY_LIGHT_1], 1, routes(GATE_1G_INPUT, i), inputs[imap(VOCT_1G_INPUT, i)]);
+			decode(&leds[KEY_LIGHT_1], 2, routes(GATE_1B_INPUT, i), inputs[imap(VOCT_1B_INPUT, i)]);
+			decode(&leds[KEY_LIGHT_2], 0, routes(GATE_2R_INPUT, i), inputs[imap(VOCT_2R_INPUT, i)]);
+			decode(&leds[KEY_LIGHT_2], 1, routes(GATE_2G_INPUT, i), inputs[imap(VOCT_2G_INPUT, i)]);
+			decode(&leds[KEY_LIGHT_2], 2, routes(GATE_2B_INPUT, i), inputs[imap(VOCT_2B_INPUT, i)]);
 		}
 
 		// Write output in one go, seems to prevent flicker
@@ -104,6 +105,7 @@ struct GtxModule : Module
 //============================================================================================================
 //! \brief The widget.
 
+#if GTX__WIDGETS
 struct GtxWidget : ModuleWidget
 {
 	GtxWidget(GtxModule *module) : ModuleWidget(module)
@@ -197,7 +199,15 @@ struct GtxWidget : ModuleWidget
 			addChild(ModuleLightWidget::create<SmallLight<RedGreenBlueLight>>(l_s(gx(i) + 30, fy(0-0.28) + 5), module, GtxModule::KEY_LIGHT_1 + 3 * (i * 12 + 11)));  // B
 		}
 	}
+
+	void appendContextMenu(Menu *menu) override
+	{
+		appendProfileMenu(menu, static_cast<GtxModule *>(module)->profile);
+	}
 };
+#else
+struct GtxWidget;
+#endif
 
 
 Model *model = Model::create<GtxModule, GtxWidget>("Gratrix", "Keys-G1", "Keys-G1", VISUAL_TAG);
@@ -78,6 +78,7 @@ struct GtxModule : Module
 	};
 
 	Decode input;
+	StepProfile profile{this};
 
 	//--------------------------------------------------------------------------------------------------------
 	//! \brief Constructor.
@@ -92,6 +93,8 @@ struct GtxModule : Module
 
 	void step() override
 	{
+		StepTimer timer(profile);
+
 		// Clear all lights
 
 		float leds[NUM_LIGHTS] = {};
@@ -128,6 +131,7 @@ struct GtxModule : Module
 };
 
 
+#if GTX__WIDGETS
 static int x(std::size_t i, double radius) { return static_cast<int>(6*15     + 0.5 + radius * dx(i, E)); }
 static int y(std::size_t i, double radius) { return static_cast<int>(-20+206  + 0.5 + radius * dy(i, E)); }
 
@@ -211,7 +215,15 @@ struct GtxWidget : ModuleWidget
 			addChild(ModuleLightWidget::create<SmallLight<RedLight>>(l_s(gx(0.5) + (i - LO_SIZE/2) * 10, fy(0-0.28) + 20), module, GtxModule::OCT_LIGHT + i));
 		}
 	}
+
+	void appendContextMenu(Menu *menu) override
+	{
+		appendProfileMenu(menu, static_cast<GtxModule *>(module)->profile);
+	}
 };
+#else
+struct GtxWidget;
+#endif
 
 
 Model *model = Model::create<GtxModule, GtxWidget>("Gratrix", "Octave-G1", "Octave-G1", SYNTH_VOICE_TAG);  // right tag?
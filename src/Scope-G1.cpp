@@ -18,7 +18,7 @@ namespace Scope_G1 {
 
 #define BUFFER_SIZE 512
 
-struct Scope : Module {
+struct Scope : Module, Voices<GTX__N> {
 	enum ParamIds {
 		X_SCALE_PARAM,
 		X_POS_PARAM,
@@ -49,8 +49,16 @@ struct Scope : Module {
 		void step(bool external, int frameCount, const Param &trig_param, const Input &x_input, const Input &trig_input);
 	};
 
+	//! \brief What the display draws, copied whole from the voices.
+	struct Frame {
+		bool active[GTX__N+1];
+		float bufferX[GTX__N+1][BUFFER_SIZE];
+	};
+
 	bool external = false;
 	Voice voice[GTX__N+1];
+	Snapshot<Frame> display;
+	StepProfile profile{this};
 
 	Scope() : Module(NUM_PARAMS, GTX__N * NUM_INPUTS, NUM_OUTPUTS, NUM_LIGHTS) {}
 
@@ -64,6 +72,8 @@ struct Scope : Module {
 
 
 void Scope::step() {
+	StepTimer timer(profile);
+
 	// Modes
 	external = params[EXTERNAL_PARAM].value <= 0.0f;
 
@@ -98,6 +108,20 @@ void Scope::step() {
 	}
 
 	voice[GTX__N].step(external, frameCount, params[TRIG_PARAM], x_sum, trig_sum);
+
+	// Hand the display a copy it can read while the buffers fill
+	if (display.due())
+	{
+		Frame &frame = display.back();
+
+		for (int k=0; k<GTX__N+1; ++k)
+		{
+			frame.active[k] = voice[k].active;
+			std::memcpy(frame.bufferX[k], voice[k].bufferX, sizeof(frame.bufferX[k]));
+		}
+
+		display.publish();
+	}
 }
 
 void Scope::Voice::step(bool external, int frameCount, const Param &trig_param, const Input &x_input, const Input &trig_input) {
@@ -145,6 +169,7 @@ void Scope::Voice::step(bool external, int frameCount, const Param &trig_param,
 }
 
 
+#if GTX__WIDGETS
 struct Display : TransparentWidget {
 	Scope *module;
 	int frame = 0;
@@ -152,7 +177,7 @@ struct Display : TransparentWidget {
 
 	struct Stats {
 		float vrms, vpp, vmin, vmax;
-		void calculate(float *values) {
+		void calculate(const float *values) {
 			vrms = 0.0f;
 			vmax = -INFINITY;
 			vmin = INFINITY;
@@ -258,6 +283,8 @@ struct Display : TransparentWidget {
 
 		static const char *stats_lab[GTX__N+1] = {"1", "2", "3", "4", "5", "6", "SUM"};
 
+		const Scope::Frame &shown = module->display.latest();
+
 		for (int k=k0; k<k1; ++k)
 		{
 			Rect a = Rect(Vec(0, 15), box.size.minus(Vec(0, 15*2)));
@@ -274,11 +301,11 @@ struct Display : TransparentWidget {
 
 			float valuesX[BUFFER_SIZE];
 			for (int i = 0; i < BUFFER_SIZE; i++) {
-				valuesX[i] = (module->voice[k].bufferX[i] + offsetX) * gainX / 10.0;
+				valuesX[i] = (shown.bufferX[k][i] + offsetX) * gainX / 10.0;
 			}
 
 			// Draw waveforms
-			if (module->voice[k].active) {
+			if (shown.active[k]) {
 				if (k&1) nvgStrokeColor(vg, nvgRGBA(0xe1, 0x02, 0x78, 0xc0));
 				else     nvgStrokeColor(vg, nvgRGBA(0x28, 0xb0, 0xf3, 0xc0));
 				drawWaveform(vg, valuesX, b);
@@ -289,7 +316,7 @@ struct Display : TransparentWidget {
 
 			// Calculate and draw stats
 			if (frame == 0) {
-				statsX[k].calculate(module->voice[k].bufferX);
+				statsX[k].calculate(shown.bufferX[k]);
 			}
 
 			Vec stats_pos = b.pos;
@@ -378,7 +405,15 @@ struct GtxWidget : ModuleWidget
 			addInput(createInputGTX<PortInMed>(Vec(px(2, i), py(2, i)), module, Scope::imap(Scope::TRIG_INPUT, i)));
 		}
 	}
+
+	void appendContextMenu(Menu *menu) override
+	{
+		appendProfileMenu(menu, static_cast<Scope *>(module)->profile);
+	}
 };
+#else
+struct GtxWidget;
+#endif
 
 
 Model *model = Model::create<Scope, GtxWidget>("Gratrix", "Scope-G1", "Scope-G1", VISUAL_TAG);
@@ -386,3 +421,7 @@ Model *model = Model::create<Scope, GtxWidget>("Gratrix", "Scope-G1", "Scope-G1"
 
 } // Scope_G1
 } // GTX
+
+
+// Local to this source, for unity builds
+#undef BUFFER_SIZE
@@ -123,7 +123,6 @@ struct GtxModule : Module {
 
 	Decode prg_nob;
 	Decode prg_cv;
-	bool running = true;
 	SchmittTrigger clockTrigger; // for external clock
 	// For buttons
 	SchmittTrigger runningTrigger;
@@ -180,8 +179,14 @@ struct GtxModule : Module {
 	};
 
 	#if LCD_ROWS
-	LcdData lcd_state[PROGRAMS][LCD_ROWS][LCD_COLS] = {};
+	//! \brief The LCDs of the program being edited, as the display draws them.
+	struct LcdFrame
+	{
+		LcdData cells[LCD_ROWS][LCD_COLS];
+	};
+
 	LcdData lcd_cache          [LCD_ROWS][LCD_COLS] = {};
+	Snapshot<LcdFrame> lcd_display;
 	#endif
 	#if PRG_ROWS
 	struct Caches
@@ -210,7 +215,6 @@ struct GtxModule : Module {
 	Caches caches;
 	#endif
 	#if BUT_ROWS
-	uint8_t but_state[PROGRAMS][BUT_ROWS][BUT_COLS] = {};
 	uint8_t but_cache          [BUT_ROWS][BUT_COLS] = {};
 	float   but_lights         [BUT_ROWS][BUT_COLS] = {};
 	#endif
@@ -230,6 +234,57 @@ struct GtxModule : Module {
 	};
 
 	PulseGenerator gatePulse;
+	Random         random;
+	StepProfile    profile{this};
+
+	//! \brief Everything toJson() saves, and what step() plays from.
+	struct Pattern
+	{
+		unsigned generation = 0;  // Of the last pattern posted from outside step() that this follows on from
+		bool     running    = true;
+		#if LCD_ROWS
+		LcdData lcd[PROGRAMS][LCD_ROWS][LCD_COLS];
+		#endif
+		#if BUT_ROWS
+		uint8_t but[PROGRAMS][BUT_ROWS][BUT_COLS] = {};
+		#endif
+	};
+
+	//! \brief A change from outside step(), and the parts of the pattern it sets.
+	struct Post
+	{
+		enum Parts : unsigned { RUNNING = 1, LCD = 2, BUT = 4 };
+
+		Pattern  pattern;
+		unsigned parts = 0;
+
+		//! \brief Sets the parts posted, leaving the rest as step() last had them.
+		void apply(Pattern &to) const
+		{
+			if (parts & RUNNING) to.running = pattern.running;
+			#if LCD_ROWS
+			if (parts & LCD) std::memcpy(to.lcd, pattern.lcd, sizeof(to.lcd));
+			#endif
+			#if BUT_ROWS
+			if (parts & BUT) std::memcpy(to.but, pattern.but, sizeof(to.but));
+			#endif
+			to.generation = pattern.generation;
+		}
+	};
+
+	// The state is only ever touched by step().  fromJson(), onReset() and randomize() post the parts they set
+	// for step() to take up over its own edits, and step() publishes a copy for toJson() whenever it changes,
+	// stamped with the generation of the last post it took up.  toJson() saves that copy, with the parts of a
+	// post step() has not yet taken up set over it.
+
+	Pattern               state;
+	bool                  changed = false;  // Since step() last published a copy of 'state'
+	Snapshot<Pattern>     saved;            // From step() to toJson()
+	Snapshot<Post>        posted;           // From fromJson(), onReset() and randomize() to step()
+	Post                  pending;          // The post last made, or being made
+	unsigned              generation = 0;   // Of the post last made
+	std::atomic<unsigned> taken{0};         // Of the post step() last took up
+	std::mutex            saving;           // Guards the side away from step(), toJson() may come from other threads
 
 	//--------------------------------------------------------------------------------------------------------
 	//! \brief Constructor.
@@ -250,8 +305,22 @@ struct GtxModule : Module {
 
 	void step() override
 	{
+		StepTimer timer(profile);
+
 		const float lightLambda = 0.075f;
 
+		// Take up a pattern loaded, reset or randomized since the last step
+
+		const Post &next = posted.latest();
+
+		if (next.pattern.generation != state.generation)
+		{
+			next.apply(state);
+			taken.store(state.generation, std::memory_order_release);
+			caches.reset();
+			changed = true;
+		}
+
 		// Decode program info
 
 		prg_nob.step(params[PROG_PARAM].value / 12.0f);
@@ -275,12 +344,13 @@ struct GtxModule : Module {
 
 		if (runningTrigger.process(params[RUN_PARAM].value))
 		{
-			running = !running;
+			state.running = !state.running;
+			changed = true;
 		}
 
 		bool nextStep = false;
 
-		if (running)
+		if (state.running)
 		{
 			if (inputs[EXT_CLOCK_INPUT].active)
 			{
@@ -327,7 +397,9 @@ struct GtxModule : Module {
 			// Clear current program
 			if (clearTrigger.process(params[CLEAR_PARAM].value))
 			{
-				clear_prog(edit_prog);
+				clear_prog(state, edit_prog);
+				caches.reset();
+				changed = true;
 				clearLight = 1.0f;
 			}
 			clearLight -= clearLight * dim;
@@ -335,7 +407,9 @@ struct GtxModule : Module {
 			// Randomise current program
 			if (randomTrigger.process(params[RANDOM_PARAM].value))
 			{
-				randomize_prog(edit_prog);
+				randomize_prog(state, edit_prog, random);
+				caches.reset();
+				changed = true;
 				randomLight = 1.0f;
 			}
 			randomLight -= randomLight * dim;
@@ -352,6 +426,7 @@ struct GtxModule : Module {
 			if (pasteTrigger.process(params[PASTE_PARAM].value))
 			{
 				paste_prog(edit_prog);
+				changed = true;
 				pasteLight = 1.0f;
 			}
 			pasteLight -= pasteLight * dim;
@@ -392,11 +467,11 @@ struct GtxModule : Module {
 
 				if (gateTriggers[row][col].process(params[but_map(row, col)].value))
 				{
-					auto state = but_state[edit_prog][row][col];
+					auto mode = state.but[edit_prog][row][col];
 
-					if (++state >= GATE_STATES)
+					if (++mode >= GATE_STATES)
 					{
-						state = GM_OFF;
+						mode = GM_OFF;
 					}
 
 					std::size_t span_r = static_cast<std::size_t>(params[SPAN_R_PARAM].value + 0.5f);
@@ -406,17 +481,19 @@ struct GtxModule : Module {
 					{
 						for (std::size_t c = col; c < col + span_c && c < BUT_COLS; ++c)
 						{
-							but_state[edit_prog][r][c] = state;
+							state.but[edit_prog][r][c] = mode;
 						}
 					}
+
+					changed = true;
 				}
 
 				// Get state of buttons for lights
 
 				{
-					bool gateOn = (running && (col == index) && (but_state[edit_prog][row][col] > 0));
+					bool gateOn = (state.running && (col == index) && (state.but[edit_prog][row][col] > 0));
 
-					switch (but_state[edit_prog][row][col])
+					switch (state.but[edit_prog][row][col])
 					{
 						case GM_CONTINUOUS :                            break;
 						case GM_RETRIGGER  : gateOn = gateOn && !pulse; break;
@@ -430,9 +507,9 @@ struct GtxModule : Module {
 					{
 						float val = (play_prog == edit_prog) ? 1.0f : 0.1f;
 
-						lights[led_map(row, col, 1)].value = but_state[edit_prog][row][col] == GM_CONTINUOUS ? 1.0f - val * but_lights[row][col] : val * but_lights[row][col];  // Green
-						lights[led_map(row, col, 2)].value = but_state[edit_prog][row][col] == GM_RETRIGGER  ? 1.0f - val * but_lights[row][col] : val * but_lights[row][col];  // Blue
-						lights[led_map(row, col, 0)].value = but_state[edit_prog][row][col] == GM_TRIGGER    ? 1.0f - val * but_lights[row][col] : val * but_lights[row][col];  // Red
+						lights[led_map(row, col, 1)].value = state.but[edit_prog][row][col] == GM_CONTINUOUS ? 1.0f - val * but_lights[row][col] : val * but_lights[row][col];  // Green
+						lights[led_map(row, col, 2)].value = state.but[edit_prog][row][col] == GM_RETRIGGER  ? 1.0f - val * but_lights[row][col] : val * but_lights[row][col];  // Blue
+						lights[led_map(row, col, 0)].value = state.but[edit_prog][row][col] == GM_TRIGGER    ? 1.0f - val * but_lights[row][col] : val * but_lights[row][col];  // Red
 					}
 					else
 					{
@@ -452,7 +529,7 @@ struct GtxModule : Module {
 		float       lcd_val[LCD_ROWS];
 		for (std::size_t row = 0; row < LCD_ROWS; ++row)
 		{
-			lcd_val[row] = lcd_state[play_prog][row][lcd_index].to_voct();
+			lcd_val[row] = state.lcd[play_prog][row][lcd_index].to_voct();
 		}
 		#endif
 
@@ -471,9 +548,9 @@ struct GtxModule : Module {
 		bool but_val[BUT_ROWS];
 		for (std::size_t row = 0; row < BUT_ROWS; ++row)
 		{
-			but_val[row] = running && (but_state[play_prog][row][index] > 0);
+			but_val[row] = state.running && (state.but[play_prog][row][index] > 0);
 
-			switch (but_state[play_prog][row][index])
+			switch (state.but[play_prog][row][index])
 			{
 				case GM_CONTINUOUS :                                        break;
 				case GM_RETRIGGER  : but_val[row] = but_val[row] && !pulse; break;
@@ -511,7 +588,7 @@ struct GtxModule : Module {
 
 		// Update LEDs
 
-		lights[RUNNING_LIGHT].value = running ? 1.0f : 0.0f;
+		lights[RUNNING_LIGHT].value = state.running ? 1.0f : 0.0f;
 		lights[RESET_LIGHT]  .value = resetLight;
 		lights[CLEAR_LIGHT]  .value = clearLight;
 		lights[RANDOM_LIGHT] .value = randomLight;
@@ -523,6 +600,48 @@ struct GtxModule : Module {
 			lights[PROG_LIGHT + i * 2    ].value = prog_leds[i * 2    ];
 			lights[PROG_LIGHT + i * 2 + 1].value = prog_leds[i * 2 + 1];
 		}
+
+		// Hand the display a copy of the program being edited, never one knob_pull() is half way through
+
+		#if LCD_ROWS
+		if (lcd_display.due())
+		{
+			std::memcpy(lcd_display.back().cells, state.lcd[edit_prog], sizeof(LcdFrame::cells));
+			lcd_display.publish();
+		}
+		#endif
+
+		// Hand toJson() a copy of the pattern once it changes, so saving never reads it mid-change
+
+		if (saved.due() && changed)
+		{
+			saved.back() = state;
+			saved.publish();
+			changed = false;
+		}
+	}
+
+	//--------------------------------------------------------------------------------------------------------
+	//! \brief The post to make a change from outside step() in, with 'saving' held.
+	//!
+	//! Starts empty once step() has taken up the last post, else keeps its parts so that step() taking up
+	//! only the newer post still sets them.  The caller sets the parts it changes in full.
+
+	Post &edit()
+	{
+		if (taken.load(std::memory_order_acquire) == generation) pending.parts = 0;
+
+		return pending;
+	}
+
+	//--------------------------------------------------------------------------------------------------------
+	//! \brief Posts the change edit() returned for step() to take up, with 'saving' held.
+
+	void post()
+	{
+		pending.pattern.generation = ++generation;
+		posted.back() = pending;
+		posted.publish();
 	}
 
 	//--------------------------------------------------------------------------------------------------------
@@ -530,12 +649,23 @@ struct GtxModule : Module {
 
 	json_t *toJson() override
 	{
+		// The copy step() last published, with any post it has yet to take up, copied so as to hold 'saving'
+		// only for the copy and not while the JSON is built
+
+		Pattern pattern;
+		{
+			std::lock_guard<std::mutex> lock(saving);
+
+			pattern = saved.latest();
+			if (pattern.generation != generation) pending.apply(pattern);
+		}
+
 		if (json_t *jo_root = json_object())
 		{
 			// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 			// Running
 
-			json_object_set_new(jo_root, "running", json_boolean(running));
+			json_object_set_new(jo_root, "running", json_boolean(pattern.running));
 
 			// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 			// LCD state
@@ -544,7 +674,7 @@ struct GtxModule : Module {
 			if (json_t *ja_progs = json_array())  { for (std::size_t prog = 0; prog < PROGRAMS; ++prog) {
 			if (json_t *ja_rows  = json_array())  { for (std::size_t row  = 0; row  < LCD_ROWS; ++row ) {
 			if (json_t *ja_cols  = json_array())  { for (std::size_t col  = 0; col  < LCD_COLS; ++col ) {
-			if (json_t *jo_data  = json_object()) { auto &current = lcd_state[prog][row][col];
+			if (json_t *jo_data  = json_object()) { auto &current = pattern.lcd[prog][row][col];
 
 				if (json_t *ji = json_integer(static_cast<int>(current.mode  ))) json_object_set_new(jo_data, "mode",   ji);
 				if (json_t *ji = json_integer(static_cast<int>(current.note  ))) json_object_set_new(jo_data, "note",   ji);
@@ -564,7 +694,7 @@ struct GtxModule : Module {
 			if (json_t *ja_progs = json_array())  { for (std::size_t prog = 0; prog < PROGRAMS; ++prog) {
 			if (json_t *ja_rows  = json_array())  { for (std::size_t row  = 0; row  < BUT_ROWS; ++row ) {
 			if (json_t *ja_cols  = json_array())  { for (std::size_t col  = 0; col  < BUT_COLS; ++col ) {
-			if (json_t *jo_data  = json_object()) { auto &current = but_state[prog][row][col];
+			if (json_t *jo_data  = json_object()) { auto &current = pattern.but[prog][row][col];
 
 				if (json_t *ji = json_integer(static_cast<int>(current))) json_object_set_new(jo_data, "mode", ji);
 
@@ -587,12 +717,19 @@ struct GtxModule : Module {
 	{
 		if (jo_root)
 		{
+			std::lock_guard<std::mutex> lock(saving);
+			Post    &change  = edit();
+			Pattern &pattern = change.pattern;
+
+			change.parts |= Post::LCD | Post::BUT;
+
 			// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 			// Running
 
 			if (json_t *jb = json_object_get(jo_root, "running"))
 			{
-				running = json_is_true(jb);
+				pattern.running = json_is_true(jb);
+				change.parts |= Post::RUNNING;
 			}
 
 			// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -603,14 +740,14 @@ struct GtxModule : Module {
 			for (std::size_t row  = 0; row  < LCD_ROWS; ++row ) {
 			for (std::size_t col  = 0; col  < LCD_COLS; ++col ) {
 
-				lcd_state[prog][row][col].reset();
+				pattern.lcd[prog][row][col].reset();
 
 			} } }
 
 			if (json_t *ja_progs = json_object_get(jo_root, "lcd")) { for (std::size_t prog = 0; prog < PROGRAMS && prog < json_array_size(ja_progs); ++prog) {
 			if (json_t *ja_rows  = json_array_get (ja_progs, prog)) { for (std::size_t row  = 0; row  < LCD_ROWS && row  < json_array_size(ja_rows);  ++row ) {
 			if (json_t *ja_cols  = json_array_get (ja_rows,  row )) { for (std::size_t col  = 0; col  < LCD_COLS && col  < json_array_size(ja_cols);  ++col ) {
-			if (json_t *jo_data  = json_array_get (ja_cols,  col )) { auto &current = lcd_state[prog][row][col];
+			if (json_t *jo_data  = json_array_get (ja_cols,  col )) { auto &current = pattern.lcd[prog][row][col];
 
 				if (json_t *jo = json_object_get(jo_data, "mode"  )) current.mode   = static_cast<int8_t>(json_integer_value(jo));
 				if (json_t *jo = json_object_get(jo_data, "note"  )) current.note   = static_cast<int8_t>(json_integer_value(jo));
@@ -618,8 +755,6 @@ struct GtxModule : Module {
 				if (json_t *jo = json_object_get(jo_data, "value" )) current.value  = static_cast<float> (json_real_value   (jo));
 
 			} } } } } } }
-
-			caches.reset();
 			#endif
 
 			// - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
@@ -630,19 +765,21 @@ struct GtxModule : Module {
 			for (std::size_t row  = 0; row  < LCD_ROWS; ++row ) {
 			for (std::size_t col  = 0; col  < LCD_COLS; ++col ) {
 
-				but_state[prog][row][col] = GM_OFF;
+				pattern.but[prog][row][col] = GM_OFF;
 
 			} } }
 
 			if (json_t *ja_progs = json_object_get(jo_root, "but")) { for (std::size_t prog = 0; prog < PROGRAMS && prog < json_array_size(ja_progs); ++prog) {
 			if (json_t *ja_rows  = json_array_get (ja_progs, prog)) { for (std::size_t row  = 0; row  < BUT_ROWS && row  < json_array_size(ja_rows);  ++row ) {
 			if (json_t *ja_cols  = json_array_get (ja_rows,  row )) { for (std::size_t col  = 0; col  < BUT_COLS && col  < json_array_size(ja_cols);  ++col ) {
-			if (json_t *jo_data  = json_array_get (ja_cols,  col )) { auto &current = but_state[prog][row][col];
+			if (json_t *jo_data  = json_array_get (ja_cols,  col )) { auto &current = pattern.but[prog][row][col];
 
 				if (json_t *jo = json_object_get(jo_data, "mode"  )) current = static_cast<uint8_t>(json_integer_value(jo));
 
 			} } } } } } }
 			#endif
+
+			post();
 		}
 	}
 
@@ -651,10 +788,16 @@ struct GtxModule : Module {
 
 	void onReset() override
 	{
+		std::lock_guard<std::mutex> lock(saving);
+		Post &change = edit();
+
 		for (std::size_t prog = 0; prog < PROGRAMS; ++prog)
 		{
-			clear_prog(prog);
+			clear_prog(change.pattern, prog);
 		}
+
+		change.parts |= Post::LCD | Post::BUT;
+		post();
 	}
 
 	//--------------------------------------------------------------------------------------------------------
@@ -662,10 +805,17 @@ struct GtxModule : Module {
 
 	void randomize() override
 	{
+		std::lock_guard<std::mutex> lock(saving);
+		Post  &change = edit();
+		Random dice;  // Not the one step() draws from
+
 		for (std::size_t prog = 0; prog < PROGRAMS; ++prog)
 		{
-			randomize_prog(prog);
+			randomize_prog(change.pattern, prog, dice);
 		}
+
+		change.parts |= Post::BUT;
+		post();
 	}
 
 	//--------------------------------------------------------------------------------------------------------
@@ -680,7 +830,7 @@ struct GtxModule : Module {
 		{
 			for (std::size_t col = 0; col < LCD_COLS; ++col)
 			{
-				lcd_state[prog][row][col].active = false;
+				state.lcd[prog][row][col].active = false;
 			}
 		}
 
@@ -709,7 +859,7 @@ struct GtxModule : Module {
 
 					for (std::size_t col = prg_col; col < col_max; col += prg_stride)
 					{
-						auto &current = lcd_state[prog][prg_row][col];
+						auto &current = state.lcd[prog][prg_row][col];
 
 						current.active = true;
 
@@ -717,18 +867,21 @@ struct GtxModule : Module {
 						{
 							current.note = prg_note;
 							current.mode = 0;
+							changed      = true;
 						}
 
 						if (caches.prg_octave.test(prg_octave))
 						{
 							current.octave = prg_octave;
 							current.mode   = 0;
+							changed        = true;
 						}
 
 						if (caches.prg_value.test(prg_value))
 						{
 							current.value = prg_value;
 							current.mode  = 1;
+							changed       = true;
 						}
 					}
 
@@ -744,14 +897,14 @@ struct GtxModule : Module {
 	//--------------------------------------------------------------------------------------------------------
 	//! \brief Clear a program.
 
-	void clear_prog(std::size_t prog)
+	static void clear_prog(Pattern &pattern, std::size_t prog)
 	{
 		#if LCD_ROWS
 		for (std::size_t row = 0; row < LCD_ROWS; ++row)
 		{
 			for (std::size_t col = 0; col < LCD_COLS; col++)
 			{
-				lcd_state[prog][row][col] = LcdData();
+				pattern.lcd[prog][row][col] = LcdData();
 			}
 		}
 		#endif
@@ -761,34 +914,30 @@ struct GtxModule : Module {
 		{
 			for (std::size_t col = 0; col < BUT_COLS; col++)
 			{
-				but_state[prog][row][col] = GM_OFF;
+				pattern.but[prog][row][col] = GM_OFF;
 			}
 		}
 		#endif
-
-		caches.reset();
 	}
 
 	//--------------------------------------------------------------------------------------------------------
 	//! \brief Randomize a program.
 
-	void randomize_prog(std::size_t prog)
+	static void randomize_prog(Pattern &pattern, std::size_t prog, Random &random)
 	{
 		#if BUT_ROWS
 		for (std::size_t row = 0; row < BUT_ROWS; row++)
 		{
 			for (std::size_t col = 0; col < BUT_COLS; col++)
 			{
-				uint32_t r = randomu32() % (GATE_STATES + 1);
+				uint32_t r = random.u32() % (GATE_STATES + 1);
 
 				if (r >= GATE_STATES) r = GM_CONTINUOUS;
 
-				but_state[prog][row][col] = r;
+				pattern.but[prog][row][col] = r;
 			}
 		}
 		#endif
-
-		caches.reset();
 	}
 
 	//--------------------------------------------------------------------------------------------------------
@@ -801,7 +950,7 @@ struct GtxModule : Module {
 		{
 			for (std::size_t col = 0; col < LCD_COLS; col++)
 			{
-				lcd_cache[row][col] = lcd_state[prog][row][col];
+				lcd_cache[row][col] = state.lcd[prog][row][col];
 			}
 		}
 		#endif
@@ -811,7 +960,7 @@ struct GtxModule : Module {
 		{
 			for (std::size_t col = 0; col < BUT_COLS; col++)
 			{
-				but_cache[row][col] = but_state[prog][row][col];
+				but_cache[row][col] = state.but[prog][row][col];
 			}
 		}
 		#endif
@@ -827,7 +976,7 @@ struct GtxModule : Module {
 		{
 			for (std::size_t col = 0; col < LCD_COLS; col++)
 			{
-				lcd_state[prog][row][col] = lcd_cache[row][col];
+				state.lcd[prog][row][col] = lcd_cache[row][col];
 			}
 		}
 		#endif
@@ -837,7 +986,7 @@ struct GtxModule : Module {
 		{
 			for (std::size_t col = 0; col < BUT_COLS; col++)
 			{
-				but_state[prog][row][col] = but_cache[row][col];
+				state.but[prog][row][col] = but_cache[row][col];
 			}
 		}
 		#endif
@@ -847,6 +996,7 @@ struct GtxModule : Module {
 };
 
 
+#if GTX__WIDGETS
 #if LCD_ROWS
 //============================================================================================================
 //! \brief Display.
@@ -935,12 +1085,14 @@ struct Display : TransparentWidget
 			static const char   *note_names[13] = {"C-", "C#", "D-", "Eb", "E-", "F-", "F#", "G-", "Ab", "A-", "Bb", "B-", "??"};
 			static const char *octave_names[10] = {"0", "1", "2", "3", "4", "5", "6", "7", "8", "?"};
 
+			const auto &lcd = module->lcd_display.latest().cells;
+
 			for (std::size_t col = 0; col < LCD_COLS; ++col)
 			{
 				for (std::size_t row = 0; row < LCD_ROWS; ++row)
 				{
-					bool active = module->lcd_state[module->edit_prog][row][col].active;
-					int  mode   = module->lcd_state[module->edit_prog][row][col].mode;
+					bool active = lcd[row][col].active;
+					int  mode   = lcd[row][col].mode;
 
 					text[row][col][0] = active ? 'p' : 'b';
 
@@ -948,8 +1100,8 @@ struct Display : TransparentWidget
 					{
 						case 0 :
 						{
-							int  note   = module->lcd_state[module->edit_prog][row][col].note;
-							int  octave = module->lcd_state[module->edit_prog][row][col].octave;
+							int  note   = lcd[row][col].note;
+							int  octave = lcd[row][col].octave;
 
 							if (note   < 0 || note   > 12) note   = 12;
 							if (octave < 0 || octave >  9) octave =  9;
@@ -963,7 +1115,7 @@ struct Display : TransparentWidget
 
 						case 1 :
 						{
-							float value = module->lcd_state[module->edit_prog][row][col].value;
+							float value = lcd[row][col].value;
 
 							snprintf(&text[row][col][1], 4, "%4.2f", value);
 						}
@@ -1298,7 +1450,15 @@ struct GtxWidget : ModuleWidget
 			#endif
 		}
 	}
+
+	void appendContextMenu(Menu *menu) override
+	{
+		appendProfileMenu(menu, static_cast<GtxModule *>(module)->profile);
+	}
 };
+#else
+struct GtxWidget;
+#endif
 
 
 Model *model = Model::create<GtxModule, GtxWidget>("Gratrix", "Seq-G1-alpha1", "Seq-G1 (alpha)", SEQUENCER_TAG);
@@ -1306,3 +1466,20 @@ Model *model = Model::create<GtxModule, GtxWidget>("Gratrix", "Seq-G1-alpha1", "
 
 } // Seq_G1
 } // GTX
+
+
+// Local to this source, for unity builds
+#undef PROGRAMS
+#undef RATIO
+#undef LCD_ROWS
+#undef LCD_COLS
+#undef LCD_TEXT
+#undef PRG_ROWS
+#undef PRG_COLS
+#undef NOB_ROWS
+#undef NOB_COLS
+#undef BUT_ROWS
+#undef BUT_COLS
+#undef OUT_LEFT
+#undef OUT_RIGHT
+#undef GATE_STATES
@@ -30,35 +30,36 @@ struct VCA : MicroModule {
 	};
 
 	VCA() : MicroModule(NUM_PARAMS, NUM_INPUTS, NUM_OUTPUTS) {}
-	void step();
 };
 
 
 //============================================================================================================
 
-void VCA::step() {
-	float v = inputs[IN_INPUT].value * params[LEVEL_PARAM].value;
-	if (inputs[LIN_INPUT].active)
-		v *= clamp(inputs[LIN_INPUT].value / 10.0f, 0.0f, 1.0f);
-	const float expBase = 50.0f;
-	if (inputs[EXP_INPUT].active)
-		v *= rescale(powf(expBase, clamp(inputs[EXP_INPUT].value / 10.0f, 0.0f, 1.0f)), 1.0f, expBase, 0.0f, 1.0f);
-	outputs[OUT_OUTPUT].value = v;
-}
-
-
-//============================================================================================================
-
-struct VCABank : Module
+template <std::size_t N>
+struct VCABank : Module, Voices<N>
 {
-	std::array<VCA, GTX__N> inst;
+	static constexpr std::size_t L = simd_lanes(N);
+
+	std::array<VCA, N> inst;
+	RouteTable<N, VCA::NUM_INPUTS> routes;
+	VoiceMask<N, VCA::NUM_INPUTS, VCA::NUM_OUTPUTS> voices;
+	Block<N, VCA::NUM_INPUTS, VCA::NUM_OUTPUTS> block;
+	ControlRate rate;
+	Ramp<L> expGain;
+	MemoLanes<L, 1> expCvToGain{1e-5f};
+	StepProfile profile{this};
 
 	VCABank()
 	:
 		Module(VCA::NUM_PARAMS,
-			(GTX__N+1) * (VCA::NUM_INPUTS  - VCA::OFF_INPUTS ) + VCA::OFF_INPUTS,
-			(GTX__N  ) * (VCA::NUM_OUTPUTS - VCA::OFF_OUTPUTS) + VCA::OFF_OUTPUTS)
-	{}
+			(N+1) * (VCA::NUM_INPUTS  - VCA::OFF_INPUTS ) + VCA::OFF_INPUTS,
+			(N  ) * (VCA::NUM_OUTPUTS - VCA::OFF_OUTPUTS) + VCA::OFF_OUTPUTS)
+	{
+		for (std::size_t i=0; i<N; ++i)
+		{
+			inst[i].bind(*this, i);
+		}
+	}
 
 	static constexpr std::size_t imap(std::size_t port, std::size_t bank)
 	{
@@ -70,28 +71,108 @@ struct VCABank : Module
 		return (port < VCA::OFF_OUTPUTS) ? port : port + bank * (VCA::NUM_OUTPUTS - VCA::OFF_OUTPUTS);
 	}
 
+	json_t *toJson() override
+	{
+		json_t *rootJ = json_object();
+
+		blockSizeToJson(rootJ, block);
+		controlRateToJson(rootJ, rate);
+
+		return rootJ;
+	}
+
+	void fromJson(json_t *rootJ) override
+	{
+		blockSizeFromJson(rootJ, block);
+		controlRateFromJson(rootJ, rate);
+	}
+
 	void step() override
 	{
-		for (std::size_t i=0; i<GTX__N; ++i)
+		StepTimer timer(profile);
+
+		if (routes.update(*this))
 		{
-			for (std::size_t p=0; p<VCA::NUM_PARAMS;  ++p) inst[i].params[p]  = params[p];
-			for (std::size_t p=0; p<VCA::NUM_INPUTS;  ++p) inst[i].inputs[p]  = inputs[imap(p, i)].active ? inputs[imap(p, i)] : inputs[imap(p, GTX__N)];
-			for (std::size_t p=0; p<VCA::NUM_OUTPUTS; ++p) inst[i].outputs[p] = outputs[omap(p, i)];
+			for (std::size_t i=0; i<N; ++i)
+			{
+				inst[i].route(routes, i);
+			}
+		}
 
-			inst[i].step();
+		voices.update(*this);
 
-			for (std::size_t p=0; p<VCA::NUM_OUTPUTS; ++p) outputs[omap(p, i)].value = inst[i].outputs[p].value;
+		if (block.push(inst))
+		{
+			DenormalGuard guard;
+			process();
 		}
 
-		float mix = 0.0f;
+		block.pull(inst);
+	}
+
+	//! \brief Runs every frame of the block, the linear gain is a pure function of each frame so it fuses
+	//! into one loop over frames and lanes.
+	void process()
+	{
+		bool linOn[L] = {};
+		bool expOn[L] = {};
+
+		gather_active(linOn, inst, VCA::LIN_INPUT);
+		gather_active(expOn, inst, VCA::EXP_INPUT);
 
-		for (std::size_t i=0; i<GTX__N; ++i)
+		const float level = params[VCA::LEVEL_PARAM].value;
+		const float mix1  = params[VCA::MIX_1_PARAM].value;
+		const float mix2  = params[VCA::MIX_2_PARAM].value;
+		const float expBase = 50.0f;
+		const float log2ExpBase = std::log2(expBase);
+
+		for (std::size_t f=0; f<block.size; ++f)
 		{
-			mix += inst[i].outputs[VCA::OUT_OUTPUT].value;
+			const float *linCv = block.in [f][VCA::LIN_INPUT];
+			const float *expCv = block.in [f][VCA::EXP_INPUT];
+			float       *v     = block.out[f][VCA::OUT_OUTPUT];
+
+			// Work out the exponential gain at control rate
+			if (rate.due())
+			{
+				alignas(16) float expLevel[L];
+
+				for (std::size_t k=0; k<voices.lanes; ++k)
+					expLevel[k] = clamp(expCv[k] / 10.0f, 0.0f, 1.0f);
+
+				const float *in[] = {expLevel};
+
+				const float *target = expCvToGain(in, voices.lanes, [&](std::size_t k) {
+					return rescale(fastmath::pow<fastmath::MEDIUM>(log2ExpBase, expLevel[k]), 1.0f, expBase, 0.0f, 1.0f);
+				});
+
+				expGain.seek(target, rate.frames(), voices.lanes);
+			}
+
+			expGain.step(voices.lanes);
+
+			for (std::size_t k=0; k<voices.lanes; ++k)
+			{
+				v[k] = block.in[f][VCA::IN_INPUT][k] * level;
+				if (linOn[k])
+					v[k] *= clamp(linCv[k] / 10.0f, 0.0f, 1.0f);
+				if (expOn[k])
+					v[k] *= expGain.value[k];
+			}
+
+			float mix = 0.0f;
+
+			for (std::size_t i=0; i<N; ++i)
+			{
+				if (voices[i]) mix += v[i];
+			}
+
+			for (std::size_t i=0; i<N; ++i)
+			{
+				block.out[f][VCA::MIX_1_OUTPUT][i] = mix * mix1;
+				block.out[f][VCA::MIX_2_OUTPUT][i] = mix * mix2;
+			}
 		}
-
-		outputs[VCA::MIX_1_OUTPUT].value = mix * params[VCA::MIX_1_PARAM].value;
-		outputs[VCA::MIX_2_OUTPUT].value = mix * params[VCA::MIX_2_PARAM].value;
 	}
 };
 
@@ -99,9 +180,11 @@ struct VCABank : Module
 //============================================================================================================
 //! \brief The widget.
 
+#if GTX__WIDGETS
+template <std::size_t N>
 struct GtxWidget : ModuleWidget
 {
-	GtxWidget(VCABank *module) : ModuleWidget(module)
+	GtxWidget(VCABank<N> *module) : ModuleWidget(module)
 	{
 		GTX__WIDGET();
 		box.size = Vec(12*15, 380);
@@ -134,23 +217,35 @@ struct GtxWidget : ModuleWidget
 		addOutput(createOutputGTX<PortOutMed>(Vec(fx(1+0.28), fy(-0.28)), module, VCA::MIX_1_OUTPUT));
 		addOutput(createOutputGTX<PortOutMed>(Vec(fx(1+0.28), fy(+0.28)), module, VCA::MIX_2_OUTPUT));
 
-		for (std::size_t i=0; i<GTX__N; ++i)
+		for (std::size_t i=0; i<N; ++i)
 		{
-			addInput(createInputGTX<PortInMed>(Vec(px(1, i), py(1, i)), module, VCABank::imap(VCA::LIN_INPUT, i)));
-			addInput(createInputGTX<PortInMed>(Vec(px(0, i), py(1, i)), module, VCABank::imap(VCA::EXP_INPUT, i)));
-			addInput(createInputGTX<PortInMed>(Vec(px(0, i), py(2, i)), module, VCABank::imap(VCA::IN_INPUT,  i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(1, i, N), py(1, i, N)), module, VCABank<N>::imap(VCA::LIN_INPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(0, i, N), py(1, i, N)), module, VCABank<N>::imap(VCA::EXP_INPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(0, i, N), py(2, i, N)), module, VCABank<N>::imap(VCA::IN_INPUT,  i)));
 
-			addOutput(createOutputGTX<PortOutMed>(Vec(px(1, i), py(2, i)), module, VCABank::omap(VCA::OUT_OUTPUT, i)));
+			addOutput(createOutputGTX<PortOutVoice<N>>(Vec(px(1, i, N), py(2, i, N)), module, VCABank<N>::omap(VCA::OUT_OUTPUT, i)));
 		}
 
-		addInput(createInputGTX<PortInMed>(Vec(gx(1), gy(1)), module, VCABank::imap(VCA::LIN_INPUT, GTX__N)));
-		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(1)), module, VCABank::imap(VCA::EXP_INPUT, GTX__N)));
-		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(2)), module, VCABank::imap(VCA::IN_INPUT,  GTX__N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(1), gy(1)), module, VCABank<N>::imap(VCA::LIN_INPUT, N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(1)), module, VCABank<N>::imap(VCA::EXP_INPUT, N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(2)), module, VCABank<N>::imap(VCA::IN_INPUT,  N)));
+	}
+
+	void appendContextMenu(Menu *menu) override
+	{
+		appendBlockSizeMenu(menu, static_cast<VCABank<N> *>(module)->block);
+		appendControlRateMenu(menu, static_cast<VCABank<N> *>(module)->rate);
+		appendProfileMenu(menu, static_cast<VCABank<N> *>(module)->profile);
 	}
 };
+#else
+template <std::size_t N> struct GtxWidget;
+#endif
 
 
-Model *model = Model::create<VCABank, GtxWidget>("Gratrix", "VCA-F1", "VCA-F1", AMPLIFIER_TAG);
+Model *model    = Model::create<VCABank<GTX__N>, GtxWidget<GTX__N>>("Gratrix", "VCA-F1",    "VCA-F1",    AMPLIFIER_TAG);
+Model *model_8  = Model::create<VCABank<8>,      GtxWidget<8>>     ("Gratrix", "VCA-F1-8",  "VCA-F1-8",  AMPLIFIER_TAG);
+Model *model_16 = Model::create<VCABank<16>,     GtxWidget<16>>    ("Gratrix", "VCA-F1-16", "VCA-F1-16", AMPLIFIER_TAG);
 
 
 } // VCA_F1
@@ -36,52 +36,68 @@ namespace GTX {
 namespace VCF_F1 {
 
 
-// The clipping function of a transistor pair is approximately tanh(x)
-// TODO: Put this in a lookup table. 5th order approx doesn't seem to cut it
+// The clipping function of a transistor pair is approximately tanh(x), a Pade approximant within 1e-4 of it
 inline float clip(float x) {
-	return tanhf(x);
+	return fastmath::tanh<fastmath::MEDIUM>(x);
 }
 
+//! \brief Every voice of a filter bank, one lane per voice.
+
+template <std::size_t N>
 struct LadderFilter {
-	float cutoff = 1000.0f;
-	float resonance = 1.0f;
-	float state[4] = {};
+	static constexpr std::size_t L = simd_lanes(N);
+
+	alignas(16) float cutoff[L];
+	alignas(16) float resonance[L];
+	alignas(16) float state[4][L] = {};
+	std::size_t lanes = L;  // Lanes in use, whole registers up to the last busy voice
+
+	LadderFilter() {
+		std::fill(cutoff, cutoff + L, 1000.0f);
+		std::fill(resonance, resonance + L, 1.0f);
+	}
 
-	void calculateDerivatives(float input, float *dstate, const float *state) {
-		float cutoff2Pi = 2*M_PI * cutoff;
+	void calculateDerivatives(const float *input, float dstate[4][L], const float state[4][L]) {
+		for (std::size_t k=0; k<lanes; ++k) {
+			float cutoff2Pi = 2*M_PI * cutoff[k];
 
-		float satstate0 = clip(state[0]);
-		float satstate1 = clip(state[1]);
-		float satstate2 = clip(state[2]);
+			float satstate0 = clip(state[0][k]);
+			float satstate1 = clip(state[1][k]);
+			float satstate2 = clip(state[2][k]);
 
-		dstate[0] = cutoff2Pi * (clip(input - resonance * state[3]) - satstate0);
-		dstate[1] = cutoff2Pi * (satstate0 - satstate1);
-		dstate[2] = cutoff2Pi * (satstate1 - satstate2);
-		dstate[3] = cutoff2Pi * (satstate2 - clip(state[3]));
+			dstate[0][k] = cutoff2Pi * (clip(input[k] - resonance[k] * state[3][k]) - satstate0);
+			dstate[1][k] = cutoff2Pi * (satstate0 - satstate1);
+			dstate[2][k] = cutoff2Pi * (satstate1 - satstate2);
+			dstate[3][k] = cutoff2Pi * (satstate2 - clip(state[3][k]));
+		}
 	}
 
-	void process(float input, float dt) {
-		float deriv1[4], deriv2[4], deriv3[4], deriv4[4], tempState[4];
+	void process(const float *input, float dt) {
+		alignas(16) float deriv1[4][L], deriv2[4][L], deriv3[4][L], deriv4[4][L], tempState[4][L];
 
 		calculateDerivatives(input, deriv1, state);
 		for (int i = 0; i < 4; i++)
-			tempState[i] = state[i] + 0.5f * dt * deriv1[i];
+			for (std::size_t k=0; k<lanes; ++k)
+				tempState[i][k] = state[i][k] + 0.5f * dt * deriv1[i][k];
 
 		calculateDerivatives(input, deriv2, tempState);
 		for (int i = 0; i < 4; i++)
-			tempState[i] = state[i] + 0.5f * dt * deriv2[i];
+			for (std::size_t k=0; k<lanes; ++k)
+				tempState[i][k] = state[i][k] + 0.5f * dt * deriv2[i][k];
 
 		calculateDerivatives(input, deriv3, tempState);
 		for (int i = 0; i < 4; i++)
-			tempState[i] = state[i] + dt * deriv3[i];
+			for (std::size_t k=0; k<lanes; ++k)
+				tempState[i][k] = state[i][k] + dt * deriv3[i][k];
 
 		calculateDerivatives(input, deriv4, tempState);
 		for (int i = 0; i < 4; i++)
-			state[i] += (1.0f / 6.0f) * dt * (deriv1[i] + 2.0f * deriv2[i] + 2.0f * deriv3[i] + deriv4[i]);
+			for (std::size_t k=0; k<lanes; ++k)
+				state[i][k] = flush(state[i][k] + (1.0f / 6.0f) * dt * (deriv1[i][k] + 2.0f * deriv2[i][k] + 2.0f * deriv3[i][k] + deriv4[i][k]));
 	}
 	void reset() {
 		for (int i = 0; i < 4; i++) {
-			state[i] = 0.0f;
+			std::fill(state[i], state[i] + L, 0.0f);
 		}
 	}
 };
@@ -111,54 +127,46 @@ struct VCF : MicroModule {
 		NUM_OUTPUTS
 	};
 
-	LadderFilter filter;
-
 	VCF() : MicroModule(NUM_PARAMS, NUM_INPUTS, NUM_OUTPUTS) {}
-	void step();
-	void onReset() {
-		filter.reset();
-	}
 };
 
 
 //============================================================================================================
 
-void VCF::step() {
-	float input = inputs[IN_INPUT].value / 5.0f;
-	float drive = params[DRIVE_PARAM].value + inputs[DRIVE_INPUT].value / 10.0f;
-	float gain = powf(100.0f, drive);
-	input *= gain;
-	// Add -60dB noise to bootstrap self-oscillation
-	input += 1e-6f * (2.0f*randomUniform() - 1.0f);
-
-	// Set resonance
-	float res = params[RES_PARAM].value + inputs[RES_INPUT].value / 5.0f;
-	res = 5.5f * clamp(res, 0.0f, 1.0f);
-	filter.resonance = res;
-
-	// Set cutoff frequency
-	float cutoffExp = params[FREQ_PARAM].value + params[FREQ_CV_PARAM].value * inputs[FREQ_INPUT].value / 5.0f;
-	cutoffExp = clamp(cutoffExp, 0.0f, 1.0f);
-	const float minCutoff = 15.0f;
-	const float maxCutoff = 8400.0f;
-	filter.cutoff = minCutoff * powf(maxCutoff / minCutoff, cutoffExp);
-
-	// Push a sample to the state filter
-	filter.process(input, 1.0f/engineGetSampleRate());
-
-	// Set outputs
-	outputs[LPF_OUTPUT].value = 5.0f * filter.state[3];
-	outputs[HPF_OUTPUT].value = 5.0f * (input - filter.state[3]);
-}
-
-
-//============================================================================================================
-
-struct VCFBank : Module
+template <std::size_t N>
+struct VCFBank : Module, Voices<N>
 {
-	std::array<VCF, GTX__N> inst;
+	static constexpr std::size_t L = simd_lanes(N);
+
+	std::array<VCF, N> inst;
+	RouteTable<N, VCF::NUM_INPUTS> routes;
+	VoiceMask<N, VCF::NUM_INPUTS, VCF::NUM_OUTPUTS> voices;
+	//! \brief The filters of W lanes of voices, whole registers, and what they ramp and remember between frames.
+	template <std::size_t W>
+	struct Filters
+	{
+		LadderFilter<W> filter;
+		Random random;
+		Ramp<W> gain;
+		Ramp<W> cutoff;
+		MemoLanes<W, 1> driveToGain    {1e-5f};
+		MemoLanes<W, 1> cutoffExpToFreq{1e-5f};
+	};
 
-	VCFBank() : Module(VCF::NUM_PARAMS, (GTX__N+1) * VCF::NUM_INPUTS, GTX__N * VCF::NUM_OUTPUTS) {}
+	Filters<L> all;
+	std::array<Filters<GTX__SIMD>, L / GTX__SIMD> registers;  // When voice threads are set
+	Block<N, VCF::NUM_INPUTS, VCF::NUM_OUTPUTS> block;
+	ControlRate rate;
+	VoiceThreads threads;
+	StepProfile profile{this};
+
+	VCFBank() : Module(VCF::NUM_PARAMS, (N+1) * VCF::NUM_INPUTS, N * VCF::NUM_OUTPUTS)
+	{
+		for (std::size_t i=0; i<N; ++i)
+		{
+			inst[i].bind(*this, i);
+		}
+	}
 
 	static std::size_t imap(std::size_t port, std::size_t bank)
 	{
@@ -170,36 +178,166 @@ struct VCFBank : Module
 		return port + bank * VCF::NUM_OUTPUTS;
 	}
 
+	json_t *toJson() override
+	{
+		json_t *rootJ = json_object();
+
+		blockSizeToJson(rootJ, block);
+		controlRateToJson(rootJ, rate);
+		voiceThreadsToJson(rootJ, threads);
+
+		return rootJ;
+	}
+
+	void fromJson(json_t *rootJ) override
+	{
+		blockSizeFromJson(rootJ, block);
+		controlRateFromJson(rootJ, rate);
+		voiceThreadsFromJson(rootJ, threads);
+	}
+
 	void step() override
 	{
-		for (std::size_t i=0; i<GTX__N; ++i)
+		StepTimer timer(profile);
+
+		if (routes.update(*this))
 		{
-			for (std::size_t p=0; p<VCF::NUM_PARAMS;  ++p) inst[i].params[p]  = params[p];
-			for (std::size_t p=0; p<VCF::NUM_INPUTS;  ++p) inst[i].inputs[p]  = inputs[imap(p, i)].active ? inputs[imap(p, i)] : inputs[imap(p, GTX__N)];
-			for (std::size_t p=0; p<VCF::NUM_OUTPUTS; ++p) inst[i].outputs[p] = outputs[omap(p, i)];
+			for (std::size_t i=0; i<N; ++i)
+			{
+				inst[i].route(routes, i);
+			}
+		}
 
-			inst[i].step();
+		voices.update(*this);
 
-			for (std::size_t p=0; p<VCF::NUM_OUTPUTS; ++p) outputs[omap(p, i)].value = inst[i].outputs[p].value;
+		if (block.push(inst))
+		{
+			DenormalGuard guard;
+			process();
 		}
+
+		block.pull(inst);
 	}
 
-	void onReset() override
+	//! \brief Runs the filters over every frame of the block, by register when threads are set.
+	void process()
+	{
+		if (!voices.lanes) return;
+
+		// Work out the drive gain and cutoff at control rate
+		bool due[GTX__BLOCK];
+		for (std::size_t f=0; f<block.size; ++f) due[f] = rate.due();
+
+		if (!threads.split())
+		{
+			render(all, 0, voices.lanes, due);
+			return;
+		}
+
+		threads.run(voices.lanes, [&](std::size_t first, std::size_t last)
+		{
+			for (std::size_t r=first; r<last; ++r) render(registers[r], r * GTX__SIMD, GTX__SIMD, due);
+		});
+	}
+
+	//! \brief Runs 'filters' over the block for the voices from lane 'o' on, its first 'lanes' lanes.
+	template <std::size_t W>
+	void render(Filters<W> &filters, std::size_t o, std::size_t lanes, const bool *due)
 	{
-		for (std::size_t i=0; i<GTX__N; ++i)
+		const float minCutoff = 15.0f;
+		const float maxCutoff = 8400.0f;
+		const float dt = 1.0f/engineGetSampleRate();
+
+		LadderFilter<W> &filter = filters.filter;
+
+		filter.lanes = lanes;
+
+		const std::size_t end = std::min(o + lanes, N);  // Past the last voice of these lanes
+
+		for (std::size_t f=0; f<block.size; ++f)
 		{
-			inst[i].onReset();
+			const float *drive  = block.in[f][VCF::DRIVE_INPUT] + o;
+			const float *res    = block.in[f][VCF::RES_INPUT]   + o;
+			const float *freqCv = block.in[f][VCF::FREQ_INPUT]  + o;
+
+			alignas(16) float input[W];
+
+			if (due[f])
+			{
+				alignas(16) float driveExp [W];
+				alignas(16) float cutoffExp[W];
+
+				for (std::size_t k=0; k<lanes; ++k)
+				{
+					driveExp [k] = params[VCF::DRIVE_PARAM].value + drive[k] / 10.0f;
+					cutoffExp[k] = clamp(params[VCF::FREQ_PARAM].value + params[VCF::FREQ_CV_PARAM].value * freqCv[k] / 5.0f, 0.0f, 1.0f);
+				}
+
+				// The exponentials only run for the lanes whose exponent moved
+				const float log2Drive  = std::log2(100.0f);
+				const float log2Cutoff = std::log2(maxCutoff / minCutoff);
+
+				const float *driveIn [] = {driveExp};
+				const float *cutoffIn[] = {cutoffExp};
+
+				const float *gainTarget = filters.driveToGain(driveIn, lanes, [&](std::size_t k) {
+					return fastmath::pow<fastmath::MEDIUM>(log2Drive, driveExp[k]);
+				});
+				const float *cutoffTarget = filters.cutoffExpToFreq(cutoffIn, lanes, [&](std::size_t k) {
+					return minCutoff * fastmath::pow<fastmath::MEDIUM>(log2Cutoff, cutoffExp[k]);
+				});
+
+				filters.gain  .seek(gainTarget,   rate.frames(), lanes);
+				filters.cutoff.seek(cutoffTarget, rate.frames(), lanes);
+			}
+
+			filters.gain  .step(lanes);
+			filters.cutoff.step(lanes);
+
+			for (std::size_t k=0; k<lanes; ++k)
+			{
+				input[k] = block.in[f][VCF::IN_INPUT][o + k] / 5.0f * filters.gain.value[k];
+
+				// Set resonance
+				filter.resonance[k] = 5.5f * clamp(params[VCF::RES_PARAM].value + res[k] / 5.0f, 0.0f, 1.0f);
+
+				// Set cutoff frequency
+				filter.cutoff[k] = filters.cutoff.value[k];
+			}
+
+			// Add -60dB noise to bootstrap self-oscillation
+			for (std::size_t i=o; i<end; ++i)
+			{
+				if (voices[i]) input[i - o] += 1e-6f * (2.0f*filters.random.uniform() - 1.0f);
+			}
+
+			// Push a sample to the state filter
+			filter.process(input, dt);
+
+			// Set outputs
+			for (std::size_t k=0; k<lanes; ++k)
+			{
+				block.out[f][VCF::LPF_OUTPUT][o + k] = 5.0f * filter.state[3][k];
+				block.out[f][VCF::HPF_OUTPUT][o + k] = 5.0f * (input[k] - filter.state[3][k]);
+			}
 		}
 	}
+
+	void onReset() override
+	{
+		all.filter.reset();
+		for (Filters<GTX__SIMD> &reg : registers) reg.filter.reset();
+	}
 };
 
 
-//============================================================================================================
+#if GTX__WIDGETS
 //! \brief The widget.
 
+template <std::size_t N>
 struct GtxWidget : ModuleWidget
 {
-	GtxWidget(VCFBank *module) : ModuleWidget(module)
+	GtxWidget(VCFBank<N> *module) : ModuleWidget(module)
 	{
 		GTX__WIDGET();
 		box.size = Vec(18*15, 380);
@@ -231,26 +369,39 @@ struct GtxWidget : ModuleWidget
 		addParam(createParamGTX<KnobFreeMed>(Vec(fx(1.1), fy(+0.28)), module, VCF::FREQ_CV_PARAM, -1.0f, 1.0f, 0.0f));
 		addParam(createParamGTX<KnobFreeMed>(Vec(fx(1.9), fy(+0.28)), module, VCF::DRIVE_PARAM, 0.0f, 1.0f, 0.0f));
 
-		for (std::size_t i=0; i<GTX__N; ++i)
+		for (std::size_t i=0; i<N; ++i)
 		{
-			addInput(createInputGTX<PortInMed>(Vec(px(0, i), py(1, i)), module, VCFBank::imap(VCF::FREQ_INPUT,  i)));
-			addInput(createInputGTX<PortInMed>(Vec(px(1, i), py(1, i)), module, VCFBank::imap(VCF::RES_INPUT,   i)));
-			addInput(createInputGTX<PortInMed>(Vec(px(1, i), py(2, i)), module, VCFBank::imap(VCF::DRIVE_INPUT, i)));
-			addInput(createInputGTX<PortInMed>(Vec(px(0, i), py(2, i)), module, VCFBank::imap(VCF::IN_INPUT,    i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(0, i, N), py(1, i, N)), module, VCFBank<N>::imap(VCF::FREQ_INPUT,  i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(1, i, N), py(1, i, N)), module, VCFBank<N>::imap(VCF::RES_INPUT,   i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(1, i, N), py(2, i, N)), module, VCFBank<N>::imap(VCF::DRIVE_INPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(0, i, N), py(2, i, N)), module, VCFBank<N>::imap(VCF::IN_INPUT,    i)));
 
-			addOutput(createOutputGTX<PortOutMed>(Vec(px(2, i), py(2, i)), module, VCFBank::omap(VCF::LPF_OUTPUT,  i)));
-			addOutput(createOutputGTX<PortOutMed>(Vec(px(2, i), py(1, i)), module, VCFBank::omap(VCF::HPF_OUTPUT,  i)));
+			addOutput(createOutputGTX<PortOutVoice<N>>(Vec(px(2, i, N), py(2, i, N)), module, VCFBank<N>::omap(VCF::LPF_OUTPUT,  i)));
+			addOutput(createOutputGTX<PortOutVoice<N>>(Vec(px(2, i, N), py(1, i, N)), module, VCFBank<N>::omap(VCF::HPF_OUTPUT,  i)));
 		}
 
-		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(1)), module, VCFBank::imap(VCF::FREQ_INPUT,  GTX__N)));
-		addInput(createInputGTX<PortInMed>(Vec(gx(1), gy(1)), module, VCFBank::imap(VCF::RES_INPUT,   GTX__N)));
-		addInput(createInputGTX<PortInMed>(Vec(gx(1), gy(2)), module, VCFBank::imap(VCF::DRIVE_INPUT, GTX__N)));
-		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(2)), module, VCFBank::imap(VCF::IN_INPUT,    GTX__N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(1)), module, VCFBank<N>::imap(VCF::FREQ_INPUT,  N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(1), gy(1)), module, VCFBank<N>::imap(VCF::RES_INPUT,   N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(1), gy(2)), module, VCFBank<N>::imap(VCF::DRIVE_INPUT, N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(2)), module, VCFBank<N>::imap(VCF::IN_INPUT,    N)));
+	}
+
+	void appendContextMenu(Menu *menu) override
+	{
+		appendBlockSizeMenu(menu, static_cast<VCFBank<N> *>(module)->block);
+		appendControlRateMenu(menu, static_cast<VCFBank<N> *>(module)->rate);
+		appendVoiceThreadsMenu(menu, static_cast<VCFBank<N> *>(module)->threads);
+		appendProfileMenu(menu, static_cast<VCFBank<N> *>(module)->profile);
 	}
 };
+#else
+template <std::size_t N> struct GtxWidget;
+#endif
 
 
-Model *model = Model::create<VCFBank, GtxWidget>("Gratrix", "VCF-F1", "VCF-F1", FILTER_TAG);
+Model *model    = Model::create<VCFBank<GTX__N>, GtxWidget<GTX__N>>("Gratrix", "VCF-F1",    "VCF-F1",    FILTER_TAG);
+Model *model_8  = Model::create<VCFBank<8>,      GtxWidget<8>>     ("Gratrix", "VCF-F1-8",  "VCF-F1-8",  FILTER_TAG);
+Model *model_16 = Model::create<VCFBank<16>,     GtxWidget<16>>    ("Gratrix", "VCF-F1-16", "VCF-F1-16", FILTER_TAG);
 
 
 } // VCF_F1
@@ -11,155 +11,223 @@ extern float triTable[2048];
 
 
 //============================================================================================================
+//! \brief Rack's Decimator run over every voice of a bank at once.
+//!
+//! The history holds one row of lanes per oversampled frame so each filter tap is a single lane-wide
+//! multiply-add.
+
+template <std::size_t N, int OVERSAMPLE, int QUALITY>
+struct DecimatorLanes {
+	static constexpr std::size_t L = simd_lanes(N);
+	static_assert(OVERSAMPLE % 4 == 0, "the ring splits into runs of whole groups of four taps");
+
+	alignas(16) float inBuffer[OVERSAMPLE*QUALITY][L];
+	float kernel[OVERSAMPLE*QUALITY];
+	int inIndex;
+
+	DecimatorLanes() {
+		Decimator<OVERSAMPLE, QUALITY> reference;
+		std::memcpy(kernel, reference.kernel, sizeof(kernel));
+		reset();
+	}
+	void reset() {
+		inIndex = 0;
+		std::memset(inBuffer, 0, sizeof(inBuffer));
+	}
+	void process(float *out, const float in[OVERSAMPLE][L], std::size_t lanes = L) {
+		for (int i = 0; i < OVERSAMPLE; i++)
+			for (std::size_t k=0; k<lanes; ++k) inBuffer[inIndex + i][k] = flush(in[i][k]);
+		inIndex += OVERSAMPLE;
+		inIndex %= OVERSAMPLE*QUALITY;
+
+		// Four running sums, so a bank of one register is not held up waiting on each add in turn
+		alignas(16) float sum0[L] = {}, sum1[L] = {}, sum2[L] = {}, sum3[L] = {};
+
+		// Newest frame first, walking back through the ring in two contiguous runs, four taps at a time
+		int i = 0;
+		for (int index = inIndex - 1; index >= 0; index -= 4, i += 4)
+			for (std::size_t k=0; k<lanes; ++k) {
+				sum0[k] += kernel[i    ] * inBuffer[index    ][k];
+				sum1[k] += kernel[i + 1] * inBuffer[index - 1][k];
+				sum2[k] += kernel[i + 2] * inBuffer[index - 2][k];
+				sum3[k] += kernel[i + 3] * inBuffer[index - 3][k];
+			}
+		for (int index = OVERSAMPLE*QUALITY - 1; index >= inIndex; index -= 4, i += 4)
+			for (std::size_t k=0; k<lanes; ++k) {
+				sum0[k] += kernel[i    ] * inBuffer[index    ][k];
+				sum1[k] += kernel[i + 1] * inBuffer[index - 1][k];
+				sum2[k] += kernel[i + 2] * inBuffer[index - 2][k];
+				sum3[k] += kernel[i + 3] * inBuffer[index - 3][k];
+			}
+
+		for (std::size_t k=0; k<lanes; ++k) out[k] = (sum0[k] + sum1[k]) + (sum2[k] + sum3[k]);
+	}
+};
+
+
+//============================================================================================================
+//! \brief Every voice of an oscillator bank, one lane per voice.
 
-template <int OVERSAMPLE, int QUALITY>
+template <std::size_t N, int OVERSAMPLE, int QUALITY>
 struct VoltageControlledOscillator {
+	static constexpr std::size_t L = simd_lanes(N);
+
 	bool analog = false;
 	bool soft = false;
-	float lastSyncValue = 0.0f;
-	float phase = 0.0f;
-	float freq;
-	float pw = 0.5f;
-	float pitch;
-	bool syncEnabled = false;
-	bool syncDirection = false;
-
-	Decimator<OVERSAMPLE, QUALITY> sinDecimator;
-	Decimator<OVERSAMPLE, QUALITY> triDecimator;
-	Decimator<OVERSAMPLE, QUALITY> sawDecimator;
-	Decimator<OVERSAMPLE, QUALITY> sqrDecimator;
-	RCFilter sqrFilter;
+	std::size_t lanes = L;  // Lanes in use, whole registers up to the last busy voice
+	alignas(16) float lastSyncValue[L] = {};
+	alignas(16) float phase[L] = {};
+	Ramp<L> freq;  // Heads for the pitch set at control rate
+	MemoLanes<L, 1> pitchToFreq{1e-4f};  // Within a hundredth of a cent
+	alignas(16) float pw[L];
+	alignas(16) float pitch[L] = {};
+	bool syncEnabled[L] = {};
+	bool syncDirection[L] = {};
+
+	DecimatorLanes<N, OVERSAMPLE, QUALITY> sinDecimator;
+	DecimatorLanes<N, OVERSAMPLE, QUALITY> triDecimator;
+	DecimatorLanes<N, OVERSAMPLE, QUALITY> sawDecimator;
+	DecimatorLanes<N, OVERSAMPLE, QUALITY> sqrDecimator;
+	RCFilter sqrFilter[L];
 
 	// For analog detuning effect
-	float pitchSlew = 0.0f;
+	alignas(16) float pitchSlew[L] = {};
+	Random random;
 	int pitchSlewIndex = 0;
 
-	float sinBuffer[OVERSAMPLE] = {};
-	float triBuffer[OVERSAMPLE] = {};
-	float sawBuffer[OVERSAMPLE] = {};
-	float sqrBuffer[OVERSAMPLE] = {};
+	alignas(16) float sinBuffer[OVERSAMPLE][L] = {};
+	alignas(16) float triBuffer[OVERSAMPLE][L] = {};
+	alignas(16) float sawBuffer[OVERSAMPLE][L] = {};
+	alignas(16) float sqrBuffer[OVERSAMPLE][L] = {};
 
-	void setPitch(float pitchKnob, float pitchCv) {
-		// Compute frequency
-		pitch = pitchKnob;
-		if (analog) {
-			// Apply pitch slew
-			const float pitchSlewAmount = 3.0f;
-			pitch += pitchSlew * pitchSlewAmount;
-		}
-		else {
-			// Quantize coarse knob if digital mode
-			pitch = roundf(pitch);
+	VoltageControlledOscillator() {
+		std::fill(pw, pw + L, 0.5f);
+	}
+	void setPitch(float pitchKnob, const float *pitchCv, std::size_t frames = 1) {
+		// Quantize coarse knob if digital mode
+		float knob = analog ? pitchKnob : roundf(pitchKnob);
+		// Apply pitch slew
+		const float pitchSlewAmount = analog ? 3.0f : 0.0f;
+
+		for (std::size_t k=0; k<lanes; ++k) {
+			// Compute frequency
+			pitch[k] = knob + pitchSlew[k] * pitchSlewAmount + pitchCv[k];
 		}
-		pitch += pitchCv;
-		// Note C4
-		freq = 261.626f * powf(2.0f, pitch / 12.0f);
+
+		const float *in[] = {pitch};
+
+		const float *target = pitchToFreq(in, lanes, [this](std::size_t k) {
+			// Note C4
+			return 261.626f * fastmath::exp2(pitch[k] / 12.0f);
+		});
+
+		freq.seek(target, frames, lanes);
 	}
-	void setPulseWidth(float pulseWidth) {
+	void setPulseWidth(const float *pulseWidth) {
 		const float pwMin = 0.01f;
-		pw = clamp(pulseWidth, pwMin, 1.0f - pwMin);
+		for (std::size_t k=0; k<lanes; ++k)
+			pw[k] = clamp(pulseWidth[k], pwMin, 1.0f - pwMin);
 	}
 
-	void process(float deltaTime, float syncValue) {
+	void process(float deltaTime, const float *syncValue) {
 		if (analog) {
 			// Adjust pitch slew
 			if (++pitchSlewIndex > 32) {
 				const float pitchSlewTau = 100.0f; // Time constant for leaky integrator in seconds
-				pitchSlew += (randomNormal() - pitchSlew / pitchSlewTau) * engineGetSampleTime();
+				for (std::size_t k=0; k<N && k<lanes; ++k)
+					pitchSlew[k] += (random.normal() - pitchSlew[k] / pitchSlewTau) * engineGetSampleTime();
 				pitchSlewIndex = 0;
 			}
 		}
 
-		// Advance phase
-		float deltaPhase = clamp(freq * deltaTime, 1e-6, 0.5f);
-
-		// Detect sync
-		int syncIndex = -1; // Index in the oversample loop where sync occurs [0, OVERSAMPLE)
-		float syncCrossing = 0.0f; // Offset that sync occurs [0.0f, 1.0f)
-		if (syncEnabled) {
-			syncValue -= 0.01f;
-			if (syncValue > 0.0f && lastSyncValue <= 0.0f) {
-				float deltaSync = syncValue - lastSyncValue;
-				syncCrossing = 1.0f - syncValue / deltaSync;
-				syncCrossing *= OVERSAMPLE;
-				syncIndex = (int)syncCrossing;
-				syncCrossing -= syncIndex;
+		freq.step(lanes);
+
+		alignas(16) float deltaPhase[L];
+		int syncIndex[L]; // Index in the oversample loop where sync occurs [0, OVERSAMPLE)
+
+		for (std::size_t k=0; k<lanes; ++k) {
+			// Advance phase
+			deltaPhase[k] = clamp(freq.value[k] * deltaTime, 1e-6, 0.5f);
+
+			// Detect sync
+			syncIndex[k] = -1;
+			if (syncEnabled[k]) {
+				float value = syncValue[k] - 0.01f;
+				if (value > 0.0f && lastSyncValue[k] <= 0.0f) {
+					float deltaSync = value - lastSyncValue[k];
+					float syncCrossing = 1.0f - value / deltaSync; // Offset that sync occurs [0.0f, 1.0f)
+					syncIndex[k] = (int)(syncCrossing * OVERSAMPLE);
+				}
+				lastSyncValue[k] = value;
 			}
-			lastSyncValue = syncValue;
-		}
 
-		if (syncDirection)
-			deltaPhase *= -1.0f;
+			if (syncDirection[k])
+				deltaPhase[k] *= -1.0f;
 
-		sqrFilter.setCutoff(40.0f * deltaTime);
+			sqrFilter[k].setCutoff(40.0f * deltaTime);
+		}
 
 		for (int i = 0; i < OVERSAMPLE; i++) {
-			if (syncIndex == i) {
-				if (soft) {
-					syncDirection = !syncDirection;
-					deltaPhase *= -1.0f;
-				}
-				else {
-					// phase = syncCrossing * deltaPhase / OVERSAMPLE;
-					phase = 0.0f;
+			for (std::size_t k=0; k<lanes; ++k) {
+				if (syncIndex[k] == i) {
+					if (soft) {
+						syncDirection[k] = !syncDirection[k];
+						deltaPhase[k] *= -1.0f;
+					}
+					else {
+						phase[k] = 0.0f;
+					}
 				}
 			}
 
 			if (analog) {
 				// Quadratic approximation of sine, slightly richer harmonics
-				if (phase < 0.5f)
-					sinBuffer[i] = 1.f - 16.f * powf(phase - 0.25f, 2);
-				else
-					sinBuffer[i] = -1.f + 16.f * powf(phase - 0.75f, 2);
-				sinBuffer[i] *= 1.08f;
-			}
-			else {
-				sinBuffer[i] = sinf(2.f*M_PI * phase);
-			}
-			if (analog) {
-				triBuffer[i] = 1.25f * interpolateLinear(triTable, phase * 2047.f);
-			}
-			else {
-				if (phase < 0.25f)
-					triBuffer[i] = 4.f * phase;
-				else if (phase < 0.75f)
-					triBuffer[i] = 2.f - 4.f * phase;
-				else
-					triBuffer[i] = -4.f + 4.f * phase;
-			}
-			if (analog) {
-				sawBuffer[i] = 1.66f * interpolateLinear(sawTable, phase * 2047.f);
+				for (std::size_t k=0; k<lanes; ++k) {
+					float lo = phase[k] - 0.25f;
+					float hi = phase[k] - 0.75f;
+					sinBuffer[i][k] = 1.08f * ((phase[k] < 0.5f) ? 1.f - 16.f * lo * lo : -1.f + 16.f * hi * hi);
+				}
+				for (std::size_t k=0; k<lanes; ++k)
+					triBuffer[i][k] = 1.25f * interpolateLinear(triTable, phase[k] * 2047.f);
+				for (std::size_t k=0; k<lanes; ++k)
+					sawBuffer[i][k] = 1.66f * interpolateLinear(sawTable, phase[k] * 2047.f);
+				for (std::size_t k=0; k<lanes; ++k) {
+					// Simply filter here
+					sqrFilter[k].process((phase[k] < pw[k]) ? 1.f : -1.f);
+					sqrFilter[k].ystate[0] = flush(sqrFilter[k].ystate[0]);
+					sqrBuffer[i][k] = 0.71f * sqrFilter[k].highpass();
+				}
 			}
 			else {
-				if (phase < 0.5f)
-					sawBuffer[i] = 2.f * phase;
-				else
-					sawBuffer[i] = -2.f + 2.f * phase;
-			}
-			sqrBuffer[i] = (phase < pw) ? 1.f : -1.f;
-			if (analog) {
-				// Simply filter here
-				sqrFilter.process(sqrBuffer[i]);
-				sqrBuffer[i] = 0.71f * sqrFilter.highpass();
+				for (std::size_t k=0; k<lanes; ++k)
+					sinBuffer[i][k] = fastmath::sin2pi(phase[k]);
+				for (std::size_t k=0; k<lanes; ++k)
+					triBuffer[i][k] = (phase[k] < 0.25f) ? 4.f * phase[k] : (phase[k] < 0.75f) ? 2.f - 4.f * phase[k] : -4.f + 4.f * phase[k];
+				for (std::size_t k=0; k<lanes; ++k)
+					sawBuffer[i][k] = (phase[k] < 0.5f) ? 2.f * phase[k] : -2.f + 2.f * phase[k];
+				for (std::size_t k=0; k<lanes; ++k)
+					sqrBuffer[i][k] = (phase[k] < pw[k]) ? 1.f : -1.f;
 			}
 
-			// Advance phase
-			phase += deltaPhase / OVERSAMPLE;
-			phase = eucmod(phase, 1.0f);
+			// Advance phase, the step is under one cycle so wrapping once either way is enough
+			for (std::size_t k=0; k<lanes; ++k) {
+				phase[k] += deltaPhase[k] / OVERSAMPLE;
+				phase[k] += (phase[k] <  0.0f) ? 1.0f : 0.0f;
+				phase[k] -= (phase[k] >= 1.0f) ? 1.0f : 0.0f;
+			}
 		}
 	}
-
-	float sin() {
-		return sinDecimator.process(sinBuffer);
+	void sin(float *out) {
+		sinDecimator.process(out, sinBuffer, lanes);
 	}
-	float tri() {
-		return triDecimator.process(triBuffer);
+	void tri(float *out) {
+		triDecimator.process(out, triBuffer, lanes);
 	}
-	float saw() {
-		return sawDecimator.process(sawBuffer);
+	void saw(float *out) {
+		sawDecimator.process(out, sawBuffer, lanes);
 	}
-	float sqr() {
-		return sqrDecimator.process(sqrBuffer);
+	void sqr(float *out) {
+		sqrDecimator.process(out, sqrBuffer, lanes);
 	}
 };
 
@@ -195,82 +263,205 @@ struct VCO : MicroModule {
 		NUM_OUTPUTS
 	};
 
-	VoltageControlledOscillator<16, 16> oscillator;
-
 	VCO() : MicroModule(NUM_PARAMS, NUM_INPUTS, NUM_OUTPUTS) {}
-	void step();
 };
 
 
 //============================================================================================================
 
-void VCO::step() {
-	oscillator.analog = params[MODE_PARAM].value > 0.0f;
-	oscillator.soft = params[SYNC_PARAM].value <= 0.0f;
+template <std::size_t N>
+struct VCOBank : Module, Voices<N>
+{
+	static constexpr std::size_t L = simd_lanes(N);
+
+	std::array<VCO, N> inst;
+	RouteTable<N, VCO::NUM_INPUTS> routes;
+	VoiceMask<N, VCO::NUM_INPUTS, VCO::NUM_OUTPUTS> voices;
+	VoltageControlledOscillator<N, 16, 16> oscillator;
+	std::array<VoltageControlledOscillator<GTX__SIMD, 16, 16>, L / GTX__SIMD> registers;  // When voice threads are set
+	Block<N, VCO::NUM_INPUTS, VCO::NUM_OUTPUTS> block;
+	ControlRate rate;
+	VoiceThreads threads;
+	StepProfile profile{this};
+
+	//! \brief What process() works out once a block for every voice.
+	struct Controls
+	{
+		bool  fmOn  [L] = {};
+		bool  syncOn[L] = {};
+		bool  due[GTX__BLOCK];
+		bool  fm;  // Some voice is frequency modulated, so pitch is worked out every frame
+		bool  analog, soft;
+		float freqKnob, pitchFine, fmAmount, pwKnob, pwmAmount;
+		bool  sinOn, triOn, sawOn, sqrOn;
+	};
 
-	float pitchFine = 3.0f * quadraticBipolar(params[FINE_PARAM].value);
-	float pitchCv = 12.0f * inputs[PITCH_INPUT].value;
-	if (inputs[FM_INPUT].active) {
-		pitchCv += quadraticBipolar(params[FM_PARAM].value) * 12.0f * inputs[FM_INPUT].value;
+	VCOBank() : Module(VCO::NUM_PARAMS, (N+1) * VCO::NUM_INPUTS, N * VCO::NUM_OUTPUTS)
+	{
+		for (std::size_t i=0; i<N; ++i)
+		{
+			inst[i].bind(*this, i);
+		}
 	}
-	oscillator.setPitch(params[FREQ_PARAM].value, pitchFine + pitchCv);
-	oscillator.setPulseWidth(params[PW_PARAM].value + params[PWM_PARAM].value * inputs[PW_INPUT].value / 10.0f);
-	oscillator.syncEnabled = inputs[SYNC_INPUT].active;
 
-	oscillator.process(engineGetSampleTime(), inputs[SYNC_INPUT].value);
+	static std::size_t imap(std::size_t port, std::size_t bank)
+	{
+		return port + bank * VCO::NUM_INPUTS;
+	}
 
-	// Set output
-	if (outputs[SIN_OUTPUT].active)
-		outputs[SIN_OUTPUT].value = 5.0f * oscillator.sin();
-	if (outputs[TRI_OUTPUT].active)
-		outputs[TRI_OUTPUT].value = 5.0f * oscillator.tri();
-	if (outputs[SAW_OUTPUT].active)
-		outputs[SAW_OUTPUT].value = 5.0f * oscillator.saw();
-	if (outputs[SQR_OUTPUT].active)
-		outputs[SQR_OUTPUT].value = 5.0f * oscillator.sqr();
-}
+	static std::size_t omap(std::size_t port, std::size_t bank)
+	{
+		return port + bank * VCO::NUM_OUTPUTS;
+	}
 
+	json_t *toJson() override
+	{
+		json_t *rootJ = json_object();
 
-//============================================================================================================
+		blockSizeToJson(rootJ, block);
+		controlRateToJson(rootJ, rate);
+		voiceThreadsToJson(rootJ, threads);
 
-struct VCOBank : Module
-{
-	std::array<VCO, GTX__N> inst;
+		return rootJ;
+	}
 
-	VCOBank() : Module(VCO::NUM_PARAMS, (GTX__N+1) * VCO::NUM_INPUTS, GTX__N * VCO::NUM_OUTPUTS) {}
+	void fromJson(json_t *rootJ) override
+	{
+		blockSizeFromJson(rootJ, block);
+		controlRateFromJson(rootJ, rate);
+		voiceThreadsFromJson(rootJ, threads);
+	}
 
-	static std::size_t imap(std::size_t port, std::size_t bank)
+	void step() override
 	{
-		return port + bank * VCO::NUM_INPUTS;
+		StepTimer timer(profile);
+
+		if (routes.update(*this))
+		{
+			for (std::size_t i=0; i<N; ++i)
+			{
+				inst[i].route(routes, i);
+			}
+		}
+
+		voices.update(*this);
+
+		if (block.push(inst))
+		{
+			DenormalGuard guard;
+			process();
+		}
+
+		block.pull(inst);
 	}
 
-	static std::size_t omap(std::size_t port, std::size_t bank)
+	//! \brief Runs the oscillators over every frame of the block, by register when threads are set.
+	void process()
 	{
-		return port + bank * VCO::NUM_OUTPUTS;
+		if (!voices.lanes) return;
+
+		Controls c;
+
+		gather_active(c.fmOn,   inst, VCO::FM_INPUT);
+		gather_active(c.syncOn, inst, VCO::SYNC_INPUT);
+
+		c.analog    = params[VCO::MODE_PARAM].value > 0.0f;
+		c.soft      = params[VCO::SYNC_PARAM].value <= 0.0f;
+		c.freqKnob  = params[VCO::FREQ_PARAM].value;
+		c.pitchFine = 3.0f * quadraticBipolar(params[VCO::FINE_PARAM].value);
+		c.fmAmount  = quadraticBipolar(params[VCO::FM_PARAM].value) * 12.0f;
+		c.pwKnob    = params[VCO::PW_PARAM].value;
+		c.pwmAmount = params[VCO::PWM_PARAM].value;
+
+		// Only run the decimators someone is listening to
+		c.sinOn = any_active(VCO::SIN_OUTPUT);
+		c.triOn = any_active(VCO::TRI_OUTPUT);
+		c.sawOn = any_active(VCO::SAW_OUTPUT);
+		c.sqrOn = any_active(VCO::SQR_OUTPUT);
+
+		// Work out the frequency at control rate, or every frame while FM is patched, stepped FM aliases
+		c.fm = c.fmAmount != 0.0f && std::any_of(c.fmOn, c.fmOn + voices.lanes, [](bool on) { return on; });
+
+		for (std::size_t f=0; f<block.size; ++f) c.due[f] = rate.due(c.fm);
+
+		if (!threads.split())
+		{
+			render(oscillator, 0, voices.lanes, c);
+			return;
+		}
+
+		threads.run(voices.lanes, [&](std::size_t first, std::size_t last)
+		{
+			for (std::size_t r=first; r<last; ++r) render(registers[r], r * GTX__SIMD, GTX__SIMD, c);
+		});
 	}
 
-	void step() override
+	//! \brief Runs 'oscillator' over the block for the voices from lane 'o' on, its first 'lanes' lanes.
+	template <typename TOscillator>
+	void render(TOscillator &oscillator, std::size_t o, std::size_t lanes, const Controls &c)
 	{
-		for (std::size_t i=0; i<GTX__N; ++i)
+		constexpr std::size_t W = TOscillator::L;
+
+		std::copy(c.syncOn + o, c.syncOn + o + lanes, oscillator.syncEnabled);
+
+		oscillator.lanes  = lanes;
+		oscillator.analog = c.analog;
+		oscillator.soft   = c.soft;
+
+		for (std::size_t f=0; f<block.size; ++f)
 		{
-			for (std::size_t p=0; p<VCO::NUM_PARAMS;  ++p) inst[i].params[p]  = params[p];
-			for (std::size_t p=0; p<VCO::NUM_INPUTS;  ++p) inst[i].inputs[p]  = inputs[imap(p, i)].active ? inputs[imap(p, i)] : inputs[imap(p, GTX__N)];
-			for (std::size_t p=0; p<VCO::NUM_OUTPUTS; ++p) inst[i].outputs[p] = outputs[omap(p, i)];
+			const float *fmCv = block.in[f][VCO::FM_INPUT] + o;
+
+			alignas(16) float pitchCv[W];
+			alignas(16) float pwCv   [W];
+
+			if (c.due[f])
+			{
+				for (std::size_t k=0; k<lanes; ++k)
+					pitchCv[k] = c.pitchFine + (12.0f * block.in[f][VCO::PITCH_INPUT][o + k] + (c.fmOn[o + k] ? c.fmAmount * fmCv[k] : 0.0f));
+
+				oscillator.setPitch(c.freqKnob, pitchCv, rate.frames(c.fm));
+			}
 
-			inst[i].step();
+			for (std::size_t k=0; k<lanes; ++k)
+				pwCv[k] = c.pwKnob + c.pwmAmount * block.in[f][VCO::PW_INPUT][o + k] / 10.0f;
 
-			for (std::size_t p=0; p<VCO::NUM_OUTPUTS; ++p) outputs[omap(p, i)].value = inst[i].outputs[p].value;
+			oscillator.setPulseWidth(pwCv);
+
+			oscillator.process(engineGetSampleTime(), block.in[f][VCO::SYNC_INPUT] + o);
+
+			// Set output
+			if (c.sinOn) { oscillator.sin(block.out[f][VCO::SIN_OUTPUT] + o); scale(block.out[f][VCO::SIN_OUTPUT] + o, lanes); }
+			if (c.triOn) { oscillator.tri(block.out[f][VCO::TRI_OUTPUT] + o); scale(block.out[f][VCO::TRI_OUTPUT] + o, lanes); }
+			if (c.sawOn) { oscillator.saw(block.out[f][VCO::SAW_OUTPUT] + o); scale(block.out[f][VCO::SAW_OUTPUT] + o, lanes); }
+			if (c.sqrOn) { oscillator.sqr(block.out[f][VCO::SQR_OUTPUT] + o); scale(block.out[f][VCO::SQR_OUTPUT] + o, lanes); }
 		}
 	}
+
+	bool any_active(std::size_t port) const
+	{
+		for (std::size_t i=0; i<N; ++i)
+		{
+			if (outputs[omap(port, i)].active) return true;
+		}
+
+		return false;
+	}
+
+	static void scale(float *out, std::size_t lanes)
+	{
+		for (std::size_t k=0; k<lanes; ++k) out[k] *= 5.0f;
+	}
 };
 
 
-//============================================================================================================
+#if GTX__WIDGETS
 //! \brief The widget.
 
+template <std::size_t N>
 struct GtxWidget : ModuleWidget
 {
-	GtxWidget(VCOBank *module) : ModuleWidget(module)
+	GtxWidget(VCOBank<N> *module) : ModuleWidget(module)
 	{
 		GTX__WIDGET();
 		box.size = Vec(24*15, 380);
@@ -308,28 +499,41 @@ struct GtxWidget : ModuleWidget
 		addParam(createParamGTX<KnobFreeMed>(Vec(fx(2.1), fy(+0.28)), module, VCO::FM_PARAM, 0.0f, 1.0f, 0.0f));
 		addParam(createParamGTX<KnobFreeMed>(Vec(fx(2.9), fy(+0.28)), module, VCO::PWM_PARAM, 0.0f, 1.0f, 0.0f));
 
-		for (std::size_t i=0; i<GTX__N; ++i)
+		for (std::size_t i=0; i<N; ++i)
 		{
-			addInput(createInputGTX<PortInMed>(Vec(px(0, i), py(2, i)), module, VCOBank::imap(VCO::PITCH_INPUT, i)));
-			addInput(createInputGTX<PortInMed>(Vec(px(0, i), py(1, i)), module, VCOBank::imap(VCO::FM_INPUT,    i)));
-			addInput(createInputGTX<PortInMed>(Vec(px(1, i), py(2, i)), module, VCOBank::imap(VCO::SYNC_INPUT,  i)));
-			addInput(createInputGTX<PortInMed>(Vec(px(1, i), py(1, i)), module, VCOBank::imap(VCO::PW_INPUT,    i)));
-
-			addOutput(createOutputGTX<PortOutMed>(Vec(px(2, i), py(1, i)), module, VCOBank::omap(VCO::SIN_OUTPUT, i)));
-			addOutput(createOutputGTX<PortOutMed>(Vec(px(2, i), py(2, i)), module, VCOBank::omap(VCO::TRI_OUTPUT, i)));
-			addOutput(createOutputGTX<PortOutMed>(Vec(px(3, i), py(1, i)), module, VCOBank::omap(VCO::SAW_OUTPUT, i)));
-			addOutput(createOutputGTX<PortOutMed>(Vec(px(3, i), py(2, i)), module, VCOBank::omap(VCO::SQR_OUTPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(0, i, N), py(2, i, N)), module, VCOBank<N>::imap(VCO::PITCH_INPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(0, i, N), py(1, i, N)), module, VCOBank<N>::imap(VCO::FM_INPUT,    i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(1, i, N), py(2, i, N)), module, VCOBank<N>::imap(VCO::SYNC_INPUT,  i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(1, i, N), py(1, i, N)), module, VCOBank<N>::imap(VCO::PW_INPUT,    i)));
+
+			addOutput(createOutputGTX<PortOutVoice<N>>(Vec(px(2, i, N), py(1, i, N)), module, VCOBank<N>::omap(VCO::SIN_OUTPUT, i)));
+			addOutput(createOutputGTX<PortOutVoice<N>>(Vec(px(2, i, N), py(2, i, N)), module, VCOBank<N>::omap(VCO::TRI_OUTPUT, i)));
+			addOutput(createOutputGTX<PortOutVoice<N>>(Vec(px(3, i, N), py(1, i, N)), module, VCOBank<N>::omap(VCO::SAW_OUTPUT, i)));
+			addOutput(createOutputGTX<PortOutVoice<N>>(Vec(px(3, i, N), py(2, i, N)), module, VCOBank<N>::omap(VCO::SQR_OUTPUT, i)));
 		}
 
-		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(2)), module, VCOBank::imap(VCO::PITCH_INPUT, GTX__N)));
-		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(1)), module, VCOBank::imap(VCO::FM_INPUT,    GTX__N)));
-		addInput(createInputGTX<PortInMed>(Vec(gx(1), gy(2)), module, VCOBank::imap(VCO::SYNC_INPUT,  GTX__N)));
-		addInput(createInputGTX<PortInMed>(Vec(gx(1), gy(1)), module, VCOBank::imap(VCO::PW_INPUT,    GTX__N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(2)), module, VCOBank<N>::imap(VCO::PITCH_INPUT, N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(1)), module, VCOBank<N>::imap(VCO::FM_INPUT,    N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(1), gy(2)), module, VCOBank<N>::imap(VCO::SYNC_INPUT,  N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(1), gy(1)), module, VCOBank<N>::imap(VCO::PW_INPUT,    N)));
+	}
+
+	void appendContextMenu(Menu *menu) override
+	{
+		appendBlockSizeMenu(menu, static_cast<VCOBank<N> *>(module)->block);
+		appendControlRateMenu(menu, static_cast<VCOBank<N> *>(module)->rate);
+		appendVoiceThreadsMenu(menu, static_cast<VCOBank<N> *>(module)->threads);
+		appendProfileMenu(menu, static_cast<VCOBank<N> *>(module)->profile);
 	}
 };
+#else
+template <std::size_t N> struct GtxWidget;
+#endif
 
 
-Model *model = Model::create<VCOBank, GtxWidget>("Gratrix", "VCO-F1", "VCO-F1", OSCILLATOR_TAG);
+Model *model    = Model::create<VCOBank<GTX__N>, GtxWidget<GTX__N>>("Gratrix", "VCO-F1",    "VCO-F1",    OSCILLATOR_TAG);
+Model *model_8  = Model::create<VCOBank<8>,      GtxWidget<8>>     ("Gratrix", "VCO-F1-8",  "VCO-F1-8",  OSCILLATOR_TAG);
+Model *model_16 = Model::create<VCOBank<16>,     GtxWidget<16>>    ("Gratrix", "VCO-F1-16", "VCO-F1-16", OSCILLATOR_TAG);
 
 
 } // VCO_F1
@@ -360,45 +564,46 @@ struct VCO2 : MicroModule {
 		NUM_OUTPUTS
 	};
 
-	VoltageControlledOscillator<8, 8> oscillator;
-
 	VCO2() : MicroModule(NUM_PARAMS, NUM_INPUTS, NUM_OUTPUTS) {}
-	void step();
 };
 
 
 //============================================================================================================
 
-void VCO2::step() {
-	oscillator.analog = params[MODE_PARAM].value > 0.0f;
-	oscillator.soft = params[SYNC_PARAM].value <= 0.0f;
-
-	float pitchCv = params[FREQ_PARAM].value + quadraticBipolar(params[FM_PARAM].value) * 12.0f * inputs[FM_INPUT].value;
-	oscillator.setPitch(0.0f, pitchCv);
-	oscillator.syncEnabled = inputs[SYNC_INPUT].active;
-
-	oscillator.process(engineGetSampleTime(), inputs[SYNC_INPUT].value);
-
-	// Set output
-	float wave = clamp(params[WAVE_PARAM].value + inputs[WAVE_INPUT].value, 0.0f, 3.0f);
-	float out;
-	if (wave < 1.0f)
-		out = crossfade(oscillator.sin(), oscillator.tri(), wave);
-	else if (wave < 2.0f)
-		out = crossfade(oscillator.tri(), oscillator.saw(), wave - 1.0f);
-	else
-		out = crossfade(oscillator.saw(), oscillator.sqr(), wave - 2.0f);
-	outputs[OUT_OUTPUT].value = 5.0f * out;
-}
-
-
-//============================================================================================================
-
-struct VCO2Bank : Module
+template <std::size_t N>
+struct VCO2Bank : Module, Voices<N>
 {
-	std::array<VCO2, GTX__N> inst;
+	static constexpr std::size_t L = simd_lanes(N);
+
+	std::array<VCO2, N> inst;
+	RouteTable<N, VCO2::NUM_INPUTS> routes;
+	VoiceMask<N, VCO2::NUM_INPUTS, VCO2::NUM_OUTPUTS> voices;
+	VoltageControlledOscillator<N, 8, 8> oscillator;
+	std::array<VoltageControlledOscillator<GTX__SIMD, 8, 8>, L / GTX__SIMD> registers;  // When voice threads are set
+	Block<N, VCO2::NUM_INPUTS, VCO2::NUM_OUTPUTS> block;
+	ControlRate rate;
+	VoiceThreads threads;
+	StepProfile profile{this};
+
+	//! \brief What process() works out once a block for every voice.
+	struct Controls
+	{
+		bool  fmOn  [L] = {};
+		bool  syncOn[L] = {};
+		bool  due[GTX__BLOCK];
+		bool  fm;  // Some voice is frequency modulated, so pitch is worked out every frame
+		bool  needSin[GTX__BLOCK], needTri[GTX__BLOCK], needSaw[GTX__BLOCK], needSqr[GTX__BLOCK];
+		bool  analog, soft;
+		float freqKnob, fmAmount, waveKnob;
+	};
 
-	VCO2Bank() : Module(VCO2::NUM_PARAMS, (GTX__N+1) * VCO2::NUM_INPUTS, GTX__N * VCO2::NUM_OUTPUTS) {}
+	VCO2Bank() : Module(VCO2::NUM_PARAMS, (N+1) * VCO2::NUM_INPUTS, N * VCO2::NUM_OUTPUTS)
+	{
+		for (std::size_t i=0; i<N; ++i)
+		{
+			inst[i].bind(*this, i);
+		}
+	}
 
 	static std::size_t imap(std::size_t port, std::size_t bank)
 	{
@@ -410,28 +615,167 @@ struct VCO2Bank : Module
 		return port + bank * VCO2::NUM_OUTPUTS;
 	}
 
+	json_t *toJson() override
+	{
+		json_t *rootJ = json_object();
+
+		blockSizeToJson(rootJ, block);
+		controlRateToJson(rootJ, rate);
+		voiceThreadsToJson(rootJ, threads);
+
+		return rootJ;
+	}
+
+	void fromJson(json_t *rootJ) override
+	{
+		blockSizeFromJson(rootJ, block);
+		controlRateFromJson(rootJ, rate);
+		voiceThreadsFromJson(rootJ, threads);
+	}
+
 	void step() override
 	{
-		for (std::size_t i=0; i<GTX__N; ++i)
+		StepTimer timer(profile);
+
+		if (routes.update(*this))
+		{
+			for (std::size_t i=0; i<N; ++i)
+			{
+				inst[i].route(routes, i);
+			}
+		}
+
+		voices.update(*this);
+
+		if (block.push(inst))
+		{
+			DenormalGuard guard;
+			process();
+		}
+
+		block.pull(inst);
+	}
+
+	//! \brief Runs the oscillators over every frame of the block, by register when threads are set.
+	void process()
+	{
+		if (!voices.lanes) return;
+
+		Controls c;
+
+		gather_active(c.fmOn,   inst, VCO2::FM_INPUT);
+		gather_active(c.syncOn, inst, VCO2::SYNC_INPUT);
+
+		c.analog   = params[VCO2::MODE_PARAM].value > 0.0f;
+		c.soft     = params[VCO2::SYNC_PARAM].value <= 0.0f;
+		c.freqKnob = params[VCO2::FREQ_PARAM].value;
+		c.fmAmount = quadraticBipolar(params[VCO2::FM_PARAM].value) * 12.0f;
+		c.waveKnob = params[VCO2::WAVE_PARAM].value;
+
+		// Work out the frequency at control rate, or every frame while FM is patched, stepped FM aliases
+		c.fm = c.fmAmount != 0.0f && std::any_of(c.fmOn, c.fmOn + voices.lanes, [](bool on) { return on; });
+
+		for (std::size_t f=0; f<block.size; ++f) c.due[f] = rate.due(c.fm);
+
+		// Only run the decimators some voice crossfades between, the same for every register
+		for (std::size_t f=0; f<block.size; ++f)
 		{
-			for (std::size_t p=0; p<VCO2::NUM_PARAMS;  ++p) inst[i].params[p]  = params[p];
-			for (std::size_t p=0; p<VCO2::NUM_INPUTS;  ++p) inst[i].inputs[p]  = inputs[imap(p, i)].active ? inputs[imap(p, i)] : inputs[imap(p, GTX__N)];
-			for (std::size_t p=0; p<VCO2::NUM_OUTPUTS; ++p) inst[i].outputs[p] = outputs[omap(p, i)];
+			c.needSin[f] = c.needTri[f] = c.needSaw[f] = c.needSqr[f] = false;
+
+			for (std::size_t i=0; i<N; ++i)
+			{
+				if (!voices[i]) continue;
 
-			inst[i].step();
+				float wave = clamp(c.waveKnob + block.in[f][VCO2::WAVE_INPUT][i], 0.0f, 3.0f);
 
-			for (std::size_t p=0; p<VCO2::NUM_OUTPUTS; ++p) outputs[omap(p, i)].value = inst[i].outputs[p].value;
+				c.needSin[f] = c.needSin[f] || wave <  1.0f;
+				c.needTri[f] = c.needTri[f] || wave <  2.0f;
+				c.needSaw[f] = c.needSaw[f] || wave >= 1.0f;
+				c.needSqr[f] = c.needSqr[f] || wave >= 2.0f;
+			}
+		}
+
+		if (!threads.split())
+		{
+			render(oscillator, 0, voices.lanes, c);
+			return;
+		}
+
+		threads.run(voices.lanes, [&](std::size_t first, std::size_t last)
+		{
+			for (std::size_t r=first; r<last; ++r) render(registers[r], r * GTX__SIMD, GTX__SIMD, c);
+		});
+	}
+
+	//! \brief Runs 'oscillator' over the block for the voices from lane 'o' on, its first 'lanes' lanes.
+	template <typename TOscillator>
+	void render(TOscillator &oscillator, std::size_t o, std::size_t lanes, const Controls &c)
+	{
+		constexpr std::size_t W = TOscillator::L;
+
+		std::copy(c.syncOn + o, c.syncOn + o + lanes, oscillator.syncEnabled);
+
+		oscillator.lanes  = lanes;
+		oscillator.analog = c.analog;
+		oscillator.soft   = c.soft;
+
+		const std::size_t end = std::min(o + lanes, N);  // Past the last voice of these lanes
+
+		for (std::size_t f=0; f<block.size; ++f)
+		{
+			alignas(16) float pitchCv[W];
+			alignas(16) float wave   [W];
+			alignas(16) float sin    [W];
+			alignas(16) float tri    [W];
+			alignas(16) float saw    [W];
+			alignas(16) float sqr    [W];
+
+			if (c.due[f])
+			{
+				for (std::size_t k=0; k<lanes; ++k)
+					pitchCv[k] = c.freqKnob + c.fmAmount * block.in[f][VCO2::FM_INPUT][o + k];
+
+				oscillator.setPitch(0.0f, pitchCv, rate.frames(c.fm));
+			}
+
+			for (std::size_t k=0; k<lanes; ++k)
+				wave[k] = clamp(c.waveKnob + block.in[f][VCO2::WAVE_INPUT][o + k], 0.0f, 3.0f);
+
+			oscillator.process(engineGetSampleTime(), block.in[f][VCO2::SYNC_INPUT] + o);
+
+			// Set output
+			if (c.needSin[f]) oscillator.sin(sin);
+			if (c.needTri[f]) oscillator.tri(tri);
+			if (c.needSaw[f]) oscillator.saw(saw);
+			if (c.needSqr[f]) oscillator.sqr(sqr);
+
+			for (std::size_t i=o; i<end; ++i)
+			{
+				if (!voices[i]) continue;
+
+				const std::size_t k = i - o;
+
+				float out;
+				if (wave[k] < 1.0f)
+					out = crossfade(sin[k], tri[k], wave[k]);
+				else if (wave[k] < 2.0f)
+					out = crossfade(tri[k], saw[k], wave[k] - 1.0f);
+				else
+					out = crossfade(saw[k], sqr[k], wave[k] - 2.0f);
+				block.out[f][VCO2::OUT_OUTPUT][i] = 5.0f * out;
+			}
 		}
 	}
 };
 
 
-//============================================================================================================
+#if GTX__WIDGETS
 //! \brief The widget.
 
+template <std::size_t N>
 struct GtxWidget : ModuleWidget
 {
-	GtxWidget(VCO2Bank *module) : ModuleWidget(module)
+	GtxWidget(VCO2Bank<N> *module) : ModuleWidget(module)
 	{
 		GTX__WIDGET();
 		box.size = Vec(12*15, 380);
@@ -464,23 +808,36 @@ struct GtxWidget : ModuleWidget
 		addParam(createParamGTX<KnobFreeMed>(Vec(fx(0.75), fy(-0.28)), module, VCO2::WAVE_PARAM, 0.0f, 3.0f, 1.5f));
 		addParam(createParamGTX<KnobFreeMed>(Vec(fx(0.75), fy(+0.28)), module, VCO2::FM_PARAM, 0.0f, 1.0f, 0.0f));
 
-		for (std::size_t i=0; i<GTX__N; ++i)
+		for (std::size_t i=0; i<N; ++i)
 		{
-			addInput(createInputGTX<PortInMed>(Vec(px(0, i), py(1, i)), module, VCO2Bank::imap(VCO2::FM_INPUT,   i)));
-			addInput(createInputGTX<PortInMed>(Vec(px(1, i), py(1, i)), module, VCO2Bank::imap(VCO2::SYNC_INPUT, i)));
-			addInput(createInputGTX<PortInMed>(Vec(px(0, i), py(2, i)), module, VCO2Bank::imap(VCO2::WAVE_INPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(0, i, N), py(1, i, N)), module, VCO2Bank<N>::imap(VCO2::FM_INPUT,   i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(1, i, N), py(1, i, N)), module, VCO2Bank<N>::imap(VCO2::SYNC_INPUT, i)));
+			addInput(createInputGTX<PortInVoice<N>>(Vec(px(0, i, N), py(2, i, N)), module, VCO2Bank<N>::imap(VCO2::WAVE_INPUT, i)));
 
-			addOutput(createOutputGTX<PortOutMed>(Vec(px(1, i), py(2, i)), module, VCO2Bank::omap(VCO2::OUT_OUTPUT, i)));
+			addOutput(createOutputGTX<PortOutVoice<N>>(Vec(px(1, i, N), py(2, i, N)), module, VCO2Bank<N>::omap(VCO2::OUT_OUTPUT, i)));
 		}
 
-		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(1)), module, VCO2Bank::imap(VCO2::FM_INPUT,   GTX__N)));
-		addInput(createInputGTX<PortInMed>(Vec(gx(1), gy(1)), module, VCO2Bank::imap(VCO2::SYNC_INPUT, GTX__N)));
-		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(2)), module, VCO2Bank::imap(VCO2::WAVE_INPUT, GTX__N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(1)), module, VCO2Bank<N>::imap(VCO2::FM_INPUT,   N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(1), gy(1)), module, VCO2Bank<N>::imap(VCO2::SYNC_INPUT, N)));
+		addInput(createInputGTX<PortInMed>(Vec(gx(0), gy(2)), module, VCO2Bank<N>::imap(VCO2::WAVE_INPUT, N)));
+	}
+
+	void appendContextMenu(Menu *menu) override
+	{
+		appendBlockSizeMenu(menu, static_cast<VCO2Bank<N> *>(module)->block);
+		appendControlRateMenu(menu, static_cast<VCO2Bank<N> *>(module)->rate);
+		appendVoiceThreadsMenu(menu, static_cast<VCO2Bank<N> *>(module)->threads);
+		appendProfileMenu(menu, static_cast<VCO2Bank<N> *>(module)->profile);
 	}
 };
+#else
+template <std::size_t N> struct GtxWidget;
+#endif
 
 
-Model *model = Model::create<VCO2Bank, GtxWidget>("Gratrix", "VCO-F2", "VCO-F2", OSCILLATOR_TAG);
+Model *model    = Model::create<VCO2Bank<GTX__N>, GtxWidget<GTX__N>>("Gratrix", "VCO-F2",    "VCO-F2",    OSCILLATOR_TAG);
+Model *model_8  = Model::create<VCO2Bank<8>,      GtxWidget<8>>     ("Gratrix", "VCO-F2-8",  "VCO-F2-8",  OSCILLATOR_TAG);
+Model *model_16 = Model::create<VCO2Bank<16>,     GtxWidget<16>>    ("Gratrix", "VCO-F2-16", "VCO-F2-16", OSCILLATOR_TAG);
 
 
 } // VCO_F2
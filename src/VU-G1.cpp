@@ -17,7 +17,7 @@ namespace VU_G1 {
 //============================================================================================================
 //! \brief The module.
 
-struct GtxModule : Module
+struct GtxModule : Module, Voices<GTX__N>
 {
 	enum ParamIds {
 		NUM_PARAMS
@@ -33,6 +33,9 @@ struct GtxModule : Module
 		NUM_LIGHTS = 10  // N
 	};
 
+	RouteTable<GTX__N, NUM_INPUTS> routes;
+	StepProfile profile{this};
+
 	GtxModule()
 	:
 		Module(NUM_PARAMS, (GTX__N+1) * NUM_INPUTS, NUM_OUTPUTS, GTX__N * NUM_LIGHTS)
@@ -46,10 +49,14 @@ struct GtxModule : Module
 
 	void step() override
 	{
+		StepTimer timer(profile);
+
+		routes.update(*this);
+
 		for (std::size_t i=0; i<GTX__N; ++i)
 		{
-			float input = inputs[imap(IN1_INPUT, i)].active ? inputs[imap(IN1_INPUT, i)].value : inputs[imap(IN1_INPUT, GTX__N)].value;
-			float dB    = logf(fabsf(input * 0.1f)) * (10.0f / logf(20.0f));
+			float input = routes(IN1_INPUT, i).value;
+			float dB    = fastmath::log2<fastmath::COARSE>(input * 0.1f) * (10.0f * logf(2.0f) / logf(20.0f));
 			float dB2   = dB * (1.0f / 3.0f);
 
 			for (int j = 0; j < NUM_LIGHTS; j++)
@@ -66,6 +73,7 @@ struct GtxModule : Module
 //============================================================================================================
 //! \brief The widget.
 
+#if GTX__WIDGETS
 struct GtxWidget : ModuleWidget
 {
 	GtxWidget(GtxModule *module) : ModuleWidget(module)
@@ -110,7 +118,15 @@ struct GtxWidget : ModuleWidget
 			}
 		}
 	}
+
+	void appendContextMenu(Menu *menu) override
+	{
+		appendProfileMenu(menu, static_cast<GtxModule *>(module)->profile);
+	}
 };
+#else
+struct GtxWidget;
+#endif
 
 
 Model *model = Model::create<GtxModule, GtxWidget>("Gratrix", "VU-G1", "VU-G1", VISUAL_TAG);